@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2025 JTAG Switch Project
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Boot-Phase Timing
+ *
+ * Records how long each init phase of main() takes, so the seconds
+ * between power-on and "JTAG Switch ready" can be attributed to a
+ * specific phase (GPIO + settings restore, DHCP wait, HTTP server
+ * start, ...) instead of guessed at. The table is filled by the
+ * single-threaded init sequence and read only after boot, so no
+ * locking is needed; the phase count is published last.
+ */
+
+#include <zephyr/kernel.h>
+#include "boot_timing.h"
+
+static struct boot_phase phases[BOOT_TIMING_MAX_PHASES];
+static int num_phases;
+static int64_t phase_start_ms;
+static const char *phase_name;
+static int64_t ready_ms;
+
+void boot_timing_phase_begin(const char *name)
+{
+	phase_name = name;
+	phase_start_ms = k_uptime_get();
+}
+
+void boot_timing_phase_end(void)
+{
+	if (phase_name == NULL || num_phases >= BOOT_TIMING_MAX_PHASES) {
+		return;
+	}
+
+	phases[num_phases].name = phase_name;
+	phases[num_phases].start_ms = (uint32_t)phase_start_ms;
+	phases[num_phases].duration_ms =
+		(uint32_t)(k_uptime_get() - phase_start_ms);
+	phase_name = NULL;
+	num_phases++;
+}
+
+void boot_timing_mark_ready(void)
+{
+	ready_ms = k_uptime_get();
+}
+
+int boot_timing_get_phases(const struct boot_phase **phases_out)
+{
+	*phases_out = phases;
+	return num_phases;
+}
+
+int64_t boot_timing_ready_ms(void)
+{
+	return ready_ms;
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025 JTAG Switch Project
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef BOOT_TIMING_H
+#define BOOT_TIMING_H
+
+#include <zephyr/kernel.h>
+
+/* Upper bound on recorded phases; main() currently defines six */
+#define BOOT_TIMING_MAX_PHASES 8
+
+/**
+ * @brief One timed init phase of main()
+ */
+struct boot_phase {
+	const char *name;     /* Static string supplied at begin time */
+	uint32_t start_ms;    /* Uptime when the phase began */
+	uint32_t duration_ms; /* Phase wall time */
+};
+
+/**
+ * @brief Start timing a named init phase
+ *
+ * Phases do not nest: the single in-flight phase is closed by the next
+ * boot_timing_phase_end(). @p name must be a static string. Only called
+ * from the sequential init code in main(), so no locking is involved.
+ *
+ * @param name Phase name, shown in /api/info and `jtag boottime`
+ */
+void boot_timing_phase_begin(const char *name);
+
+/**
+ * @brief Close the in-flight phase and record its duration
+ */
+void boot_timing_phase_end(void);
+
+/**
+ * @brief Record the boot-complete instant
+ *
+ * Called once when main() reaches the ready message; the recorded
+ * uptime is the rack power-cycle recovery figure.
+ */
+void boot_timing_mark_ready(void);
+
+/**
+ * @brief Get the recorded phase table
+ *
+ * @param phases Set to the internal phase array
+ * @return Number of completed phases
+ */
+int boot_timing_get_phases(const struct boot_phase **phases);
+
+/**
+ * @brief Uptime at which boot completed
+ *
+ * @return Ready instant in milliseconds of uptime, 0 until boot completes
+ */
+int64_t boot_timing_ready_ms(void);
+
+#endif /* BOOT_TIMING_H */
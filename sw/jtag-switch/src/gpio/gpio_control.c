@@ -5,47 +5,308 @@
  * GPIO Control Module - JTAG Multiplexer Select Lines
  *
  * CRITICAL SAFETY CONSTRAINT:
- * The two JTAG select GPIO pins must NEVER be HIGH simultaneously.
- * This module enforces mutual exclusion to prevent hardware damage.
+ * All JTAG select GPIO pins form one mutual-exclusion group: at most ONE
+ * line may be HIGH at any time. This module enforces the constraint to
+ * prevent hardware damage.
  *
- * Valid states: 00 (both low), 01, 10
- * Invalid state: 11 (both high) - PROHIBITED
+ * Valid states: all lines LOW, or exactly one line HIGH
+ * Invalid states: two or more lines HIGH - PROHIBITED
+ *
+ * The line set is generated at compile time from the jtag-selectN device
+ * tree aliases (N contiguous from 0), so the same code scales from 2 to
+ * GPIO_CONTROL_MAX_SELECT_LINES lines with per-line state packed into a
+ * single bitmask byte.
  */
 
 #include <zephyr/kernel.h>
 #include <zephyr/drivers/gpio.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/logging/log_ctrl.h>
+#ifdef CONFIG_SETTINGS
+#include <zephyr/settings/settings.h>
+#endif
+#include <string.h>
 #include "gpio_control.h"
 
 LOG_MODULE_REGISTER(gpio_control, LOG_LEVEL_DBG);
 
-/* Device tree aliases */
-#define JTAG_SELECT0_NODE DT_ALIAS(jtag_select0)
-#define JTAG_SELECT1_NODE DT_ALIAS(jtag_select1)
+/* Fast-switch mode: skip per-operation debug logging on the actuation
+ * path. Atomic so transports can flip it without taking the state mutex.
+ */
+static atomic_t fast_mode;
 
-/* Compile-time validation */
-#if !DT_NODE_HAS_STATUS(JTAG_SELECT0_NODE, okay)
-#error "jtag-select0 alias not defined or not enabled in device tree"
-#endif
+/* Deferred-verification ("fast-ack") mode: the write path skips the
+ * inline readback pass and a periodic auditor checks the pins against
+ * the shadow mask instead. Atomics for the same reason as fast_mode.
+ */
+static atomic_t deferred_verify;
+static atomic_t verify_mismatch_count;
 
-#if !DT_NODE_HAS_STATUS(JTAG_SELECT1_NODE, okay)
-#error "jtag-select1 alias not defined or not enabled in device tree"
-#endif
+/*
+ * Select-line table, generated from the jtag-selectN device tree aliases.
+ * Aliases must be contiguous from jtag-select0; a board overlay adds lines
+ * by adding aliases, with no code change. Table lookup is constant-time
+ * indexed access.
+ */
+#define SELECT_LINE_ENTRY(i, _)						\
+	COND_CODE_1(DT_NODE_EXISTS(DT_ALIAS(jtag_select##i)),		\
+		    (GPIO_DT_SPEC_GET(DT_ALIAS(jtag_select##i), gpios),), ())
 
-/* GPIO specifications from device tree */
-static const struct gpio_dt_spec jtag_select0 =
-	GPIO_DT_SPEC_GET(JTAG_SELECT0_NODE, gpios);
-static const struct gpio_dt_spec jtag_select1 =
-	GPIO_DT_SPEC_GET(JTAG_SELECT1_NODE, gpios);
+static const struct gpio_dt_spec select_lines[] = {
+	LISTIFY(GPIO_CONTROL_MAX_SELECT_LINES, SELECT_LINE_ENTRY, ())
+};
 
-/* State tracking */
-static bool select0_state = false;
-static bool select1_state = false;
+#define NUM_SELECT_LINES ARRAY_SIZE(select_lines)
+
+BUILD_ASSERT(NUM_SELECT_LINES >= 2,
+	     "At least jtag-select0 and jtag-select1 aliases are required");
+BUILD_ASSERT(NUM_SELECT_LINES <= 8,
+	     "Select-line state must fit the packed uint8_t bitmask");
+
+/* State tracking: bit i set means line i is HIGH; at most one bit set */
+static uint8_t select_state_mask;
 static bool initialized = false;
 
+/* True when every select line lives on the same GPIO port (set at init),
+ * enabling the single masked-write fast path
+ */
+static bool lines_share_port;
+
+/**
+ * @brief Map a line bitmask (at most one bit set) onto the state model
+ *
+ * State 0 is off; state N selects line N-1. find_lsb_set() returns a
+ * 1-based bit index, which is exactly the state encoding.
+ */
+static inline enum jtag_switch_state mask_to_state(uint8_t mask)
+{
+	return (enum jtag_switch_state)(mask ? find_lsb_set(mask) : 0);
+}
+
 /* Mutex for thread-safe access to shared state */
 static K_MUTEX_DEFINE(gpio_control_mutex);
 
+/* State-change notification callbacks */
+#define MAX_CHANGE_CALLBACKS 8
+static gpio_control_change_cb_t change_callbacks[MAX_CHANGE_CALLBACKS];
+static int num_change_callbacks;
+
+/* Switch-latency histogram, protected by gpio_control_mutex */
+static struct {
+	uint32_t count;
+	uint32_t min_cycles;
+	uint32_t max_cycles;
+	uint32_t buckets[GPIO_CONTROL_LATENCY_BUCKETS];
+} latency_hist = {
+	.min_cycles = UINT32_MAX,
+};
+
+/**
+ * @brief Record one actuation latency sample into the histogram
+ *
+ * Called with gpio_control_mutex held. Bucket index is floor(log2(cycles)),
+ * clamped to the last bucket.
+ */
+static void record_latency(uint32_t cycles)
+{
+	uint32_t idx = (cycles == 0) ? 0 : (31 - __builtin_clz(cycles));
+
+	if (idx >= GPIO_CONTROL_LATENCY_BUCKETS) {
+		idx = GPIO_CONTROL_LATENCY_BUCKETS - 1;
+	}
+
+	latency_hist.buckets[idx]++;
+	latency_hist.count++;
+
+	if (cycles < latency_hist.min_cycles) {
+		latency_hist.min_cycles = cycles;
+	}
+	if (cycles > latency_hist.max_cycles) {
+		latency_hist.max_cycles = cycles;
+	}
+}
+
+/**
+ * @brief Derive a percentile (0-100) from the histogram buckets
+ *
+ * Returns the upper cycle bound of the bucket containing the requested
+ * percentile, so results are accurate to the bucket resolution.
+ */
+static uint32_t latency_percentile(uint32_t percent)
+{
+	uint32_t threshold;
+	uint32_t cumulative = 0;
+
+	if (latency_hist.count == 0) {
+		return 0;
+	}
+
+	threshold = ((uint64_t)latency_hist.count * percent + 99) / 100;
+
+	for (int i = 0; i < GPIO_CONTROL_LATENCY_BUCKETS; i++) {
+		cumulative += latency_hist.buckets[i];
+		if (cumulative >= threshold) {
+			return (i >= 31) ? UINT32_MAX : (1U << (i + 1));
+		}
+	}
+
+	return latency_hist.max_cycles;
+}
+
+/*
+ * Switch-event ring buffer. Single producer (apply_state_locked, which
+ * already runs under gpio_control_mutex); the published sequence number
+ * is the only cross-thread synchronization, so readers never add a lock
+ * to the actuation path. Each slot carries its own seq so a reader can
+ * detect that the producer lapped it mid-copy and drop the torn entry.
+ */
+BUILD_ASSERT((GPIO_CONTROL_EVENT_RING_SIZE &
+	      (GPIO_CONTROL_EVENT_RING_SIZE - 1)) == 0,
+	     "Event ring size must be a power of two");
+
+static struct gpio_control_event event_ring[GPIO_CONTROL_EVENT_RING_SIZE];
+static atomic_t event_write_seq;
+static atomic_t current_event_source = ATOMIC_INIT(GPIO_CONTROL_SRC_INTERNAL);
+
+/**
+ * @brief Record one switch-state change into the event ring
+ *
+ * Called with gpio_control_mutex held.
+ */
+static void record_event(enum jtag_switch_state old_state,
+			 enum jtag_switch_state new_state)
+{
+	const uint32_t seq = (uint32_t)atomic_get(&event_write_seq) + 1;
+	struct gpio_control_event *slot =
+		&event_ring[seq & (GPIO_CONTROL_EVENT_RING_SIZE - 1)];
+
+	slot->seq = seq;
+	slot->uptime_ms = k_uptime_get();
+	slot->old_state = old_state;
+	slot->new_state = new_state;
+	slot->source = (uint8_t)atomic_get(&current_event_source);
+
+	/* Publish: readers only trust slots with seq <= event_write_seq */
+	atomic_set(&event_write_seq, seq);
+}
+
+/**
+ * @brief Invoke all registered state-change callbacks
+ *
+ * Called with gpio_control_mutex held; k_mutex is recursive, so callbacks
+ * may safely call gpio_control_get_select() from the same thread.
+ */
+static void notify_state_change(void)
+{
+	for (int i = 0; i < num_change_callbacks; i++) {
+		change_callbacks[i]();
+	}
+}
+
+/* ========== State Persistence ========== */
+
+#ifdef CONFIG_SETTINGS
+
+#define SWITCH_SETTINGS_NAME "switch"
+#define SWITCH_SETTINGS_KEY_STATE "switch/state"
+
+/* Debounce window: a burst of toggles causes a single flash commit */
+#define STATE_SAVE_DEBOUNCE_MS 1000
+
+/* State loaded from NVS at boot, applied at the end of init */
+static uint8_t persisted_state = JTAG_STATE_OFF;
+static bool persisted_state_valid;
+
+/* Last value actually committed to flash, to skip redundant writes */
+static uint8_t last_saved_state = JTAG_STATE_OFF;
+
+/**
+ * @brief Commit the current switch state to NVS
+ *
+ * Runs on the system workqueue after the debounce window, keeping the
+ * synchronous flash write off the actuation path.
+ */
+static void state_save_work_handler(struct k_work *work)
+{
+	enum jtag_switch_state state;
+	uint8_t value;
+	int ret;
+
+	ARG_UNUSED(work);
+
+	if (gpio_control_get_state(&state) < 0) {
+		return;
+	}
+
+	value = (uint8_t)state;
+	if (value == last_saved_state) {
+		return;  /* The burst ended where it started */
+	}
+
+	ret = settings_save_one(SWITCH_SETTINGS_KEY_STATE, &value, sizeof(value));
+	if (ret < 0) {
+		LOG_ERR("Failed to persist switch state: %d", ret);
+		return;
+	}
+
+	last_saved_state = value;
+	LOG_DBG("Persisted switch state %u", value);
+}
+
+static K_WORK_DELAYABLE_DEFINE(state_save_work, state_save_work_handler);
+
+/**
+ * @brief Settings load callback
+ */
+static int switch_settings_load(const char *key, size_t len,
+				settings_read_cb read_cb, void *cb_arg)
+{
+	int rc;
+
+	if (strcmp(key, "state") == 0) {
+		uint8_t value;
+
+		rc = read_cb(cb_arg, &value, sizeof(value));
+		if (rc >= 0) {
+			if (value > NUM_SELECT_LINES) {
+				LOG_WRN("Ignoring invalid persisted state %u",
+					value);
+				return -EINVAL;
+			}
+			persisted_state = value;
+			persisted_state_valid = true;
+			LOG_INF("Loaded switch state: %u", value);
+			return 0;
+		}
+		return rc;
+	}
+
+	return -ENOENT;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(switch_state, SWITCH_SETTINGS_NAME, NULL,
+			       switch_settings_load, NULL, NULL);
+
+/**
+ * @brief Arm the debounced save after a state change
+ *
+ * k_work_schedule() keeps an already-armed deadline, so a burst of
+ * toggles results in one flash commit of the final state at most
+ * STATE_SAVE_DEBOUNCE_MS after the first change.
+ */
+static void schedule_state_save(void)
+{
+	k_work_schedule(&state_save_work, K_MSEC(STATE_SAVE_DEBOUNCE_MS));
+}
+
+#else /* CONFIG_SETTINGS */
+
+static inline void schedule_state_save(void)
+{
+}
+
+#endif /* CONFIG_SETTINGS */
+
 /* Scoped lock helper for automatic mutex cleanup */
 static inline void mutex_unlock_cleanup(struct k_mutex **mutex_ptr)
 {
@@ -59,41 +320,71 @@ static inline void mutex_unlock_cleanup(struct k_mutex **mutex_ptr)
 	struct k_mutex *_scoped_lock __unused = &mutex; \
 	k_mutex_lock(_scoped_lock, K_FOREVER)
 
+static int apply_state_locked(enum jtag_switch_state target);
+
 /**
  * @brief Verify GPIO pin state matches expected value
- * @param spec GPIO device tree spec
+ * @param line Select line index
  * @param expected Expected state (0 or 1)
- * @param line_name Name for logging (e.g., "select0")
  * @return 0 if matches, -EIO if mismatch
  *
  * Note: GPIO emulation (CONFIG_GPIO_EMUL) may not support readback correctly,
  * so verification is skipped in simulation builds.
  */
-static int verify_gpio_state(const struct gpio_dt_spec *spec,
-                             int expected, const char *line_name)
+static int verify_gpio_state(uint8_t line, int expected)
 {
 #ifdef CONFIG_GPIO_EMUL
 	/* Skip readback verification in simulation - gpio_emul doesn't support it */
-	ARG_UNUSED(spec);
+	ARG_UNUSED(line);
 	ARG_UNUSED(expected);
-	ARG_UNUSED(line_name);
 	return 0;
 #else
-	int actual = gpio_pin_get_dt(spec);
+	int actual = gpio_pin_get_dt(&select_lines[line]);
 
 	if (actual < 0) {
-		LOG_ERR("Failed to read %s: %d", line_name, actual);
+		LOG_ERR("Failed to read select%u: %d", line, actual);
 		return -EIO;
 	}
 	if (actual != expected) {
-		LOG_ERR("GPIO %s readback mismatch: expected %d, got %d",
-		        line_name, expected, actual);
+		LOG_ERR("GPIO select%u readback mismatch: expected %d, got %d",
+		        line, expected, actual);
 		return -EIO;
 	}
 	return 0;
 #endif
 }
 
+/**
+ * @brief Write every select line in a single port transaction
+ * @param logical_mask Bit i set = line i logically HIGH
+ * @return 0 on success, negative errno on failure
+ *
+ * Only valid when all lines live on the same GPIO port. Active-low
+ * device tree flags are honoured by inverting the raw bit, matching
+ * what gpio_pin_set_dt() would have written.
+ */
+static int set_mask_same_port(uint8_t logical_mask)
+{
+	gpio_port_pins_t pins = 0;
+	gpio_port_value_t value = 0;
+
+	for (uint8_t i = 0; i < NUM_SELECT_LINES; i++) {
+		const struct gpio_dt_spec *spec = &select_lines[i];
+		int val = (logical_mask >> i) & 1;
+
+		if (spec->dt_flags & GPIO_ACTIVE_LOW) {
+			val = !val;
+		}
+
+		pins |= BIT(spec->pin);
+		if (val) {
+			value |= BIT(spec->pin);
+		}
+	}
+
+	return gpio_port_set_masked_raw(select_lines[0].port, pins, value);
+}
+
 int gpio_control_init(void)
 {
 	int ret = 0;
@@ -105,69 +396,367 @@ int gpio_control_init(void)
 		return 0;
 	}
 
-	/* Check device readiness */
-	if (!gpio_is_ready_dt(&jtag_select0)) {
-		LOG_ERR("jtag-select0 GPIO device not ready");
-		return -ENODEV;
-	}
+	/*
+	 * Configure every line as an output, initially LOW (safe state).
+	 * All lines LOW satisfies the mutual exclusion constraint.
+	 */
+	lines_share_port = true;
+	for (uint8_t i = 0; i < NUM_SELECT_LINES; i++) {
+		if (!gpio_is_ready_dt(&select_lines[i])) {
+			LOG_ERR("jtag-select%u GPIO device not ready", i);
+			return -ENODEV;
+		}
+
+		ret = gpio_pin_configure_dt(&select_lines[i],
+					    GPIO_OUTPUT_INACTIVE);
+		if (ret < 0) {
+			LOG_ERR("Failed to configure jtag-select%u: %d",
+				i, ret);
+			return ret;
+		}
+
+		ret = verify_gpio_state(i, 0);
+		if (ret < 0) {
+			return ret;
+		}
 
-	if (!gpio_is_ready_dt(&jtag_select1)) {
-		LOG_ERR("jtag-select1 GPIO device not ready");
-		return -ENODEV;
+		if (select_lines[i].port != select_lines[0].port) {
+			lines_share_port = false;
+		}
 	}
 
+	select_state_mask = 0;
+	initialized = true;
+
+#ifdef CONFIG_SETTINGS
 	/*
-	 * Configure both pins as outputs, initially LOW (safe state).
-	 * Both LOW (00) satisfies the mutual exclusion constraint.
+	 * Restore the persisted switch state before the network comes up,
+	 * so a power blip does not leave the farm controller re-walking
+	 * every unit. settings_subsys_init() is idempotent; network_config
+	 * initializes it again later without harm.
 	 */
-	ret = gpio_pin_configure_dt(&jtag_select0, GPIO_OUTPUT_INACTIVE);
+	ret = settings_subsys_init();
 	if (ret < 0) {
-		LOG_ERR("Failed to configure jtag-select0: %d", ret);
-		return ret;
+		LOG_WRN("Settings subsystem unavailable: %d", ret);
+	} else {
+		ret = settings_load_subtree(SWITCH_SETTINGS_NAME);
+		if (ret < 0) {
+			LOG_WRN("Failed to load switch settings: %d", ret);
+		}
 	}
 
-	/* Verify select0 configured correctly */
-	ret = verify_gpio_state(&jtag_select0, 0, "select0");
-	if (ret < 0) {
-		return ret;
+	if (persisted_state_valid) {
+		last_saved_state = persisted_state;
+		ret = apply_state_locked((enum jtag_switch_state)persisted_state);
+		if (ret < 0) {
+			LOG_ERR("Failed to restore switch state: %d", ret);
+		} else {
+			LOG_INF("Restored switch state %u from NVS",
+				persisted_state);
+		}
 	}
+	ret = 0;
+#endif /* CONFIG_SETTINGS */
 
-	ret = gpio_pin_configure_dt(&jtag_select1, GPIO_OUTPUT_INACTIVE);
-	if (ret < 0) {
-		LOG_ERR("Failed to configure jtag-select1: %d", ret);
-		return ret;
+	LOG_INF("GPIO control initialized (%u select lines):",
+		(unsigned int)NUM_SELECT_LINES);
+	for (uint8_t i = 0; i < NUM_SELECT_LINES; i++) {
+		LOG_INF("  jtag-select%u: %s pin %d",
+			i, select_lines[i].port->name, select_lines[i].pin);
+	}
+
+	return 0;  /* Mutex auto-unlocks here */
+}
+
+/**
+ * @brief Restore the select lines to a previous state mask
+ *
+ * Best-effort rollback used when verification fails. Clears raised
+ * lines before re-raising, preserving mutual exclusion.
+ */
+static void restore_mask_locked(uint8_t prev_mask)
+{
+	int ret = 0;
+
+	if (lines_share_port) {
+		ret = set_mask_same_port(prev_mask);
+	} else {
+		for (uint8_t i = 0; i < NUM_SELECT_LINES && ret == 0; i++) {
+			if (!(prev_mask & BIT(i))) {
+				ret = gpio_pin_set_dt(&select_lines[i], 0);
+			}
+		}
+		for (uint8_t i = 0; i < NUM_SELECT_LINES && ret == 0; i++) {
+			if (prev_mask & BIT(i)) {
+				ret = gpio_pin_set_dt(&select_lines[i], 1);
+			}
+		}
+	}
+
+	if (ret == 0) {
+		LOG_WRN("Rolled back select lines after failure");
+	} else {
+		LOG_ERR("CRITICAL: Select line rollback failed: %d", ret);
+	}
+}
+
+/**
+ * @brief Transition the select lines to one of the legal states
+ *
+ * Called with gpio_control_mutex held. Performs the whole transition
+ * with a single verification pass; on same-port boards the pin writes
+ * collapse into one masked port transaction with no intermediate
+ * all-low dwell. The target mask carries at most one set bit by
+ * construction, so illegal multi-line states are unrepresentable.
+ */
+static int apply_state_locked(enum jtag_switch_state target)
+{
+	const uint8_t target_mask =
+		(target == JTAG_STATE_OFF) ? 0 : BIT((uint8_t)target - 1);
+	const uint8_t prev_mask = select_state_mask;
+	uint32_t actuation_start;
+	int ret;
+
+	/* Timestamp the actuation path: pin writes plus readback verification */
+	actuation_start = k_cycle_get_32();
+
+	if (lines_share_port) {
+		/*
+		 * FAST PATH: all lines share a GPIO port, so the whole
+		 * transition is one masked port write. This collapses the
+		 * per-line driver round-trips and no two lines are ever
+		 * HIGH together, not even transiently.
+		 */
+		ret = set_mask_same_port(target_mask);
+		if (ret < 0) {
+			LOG_ERR("Failed masked write for select lines: %d", ret);
+			return ret;
+		}
+	} else {
+		/*
+		 * SAFETY: Enforce mutual exclusion constraint across ports.
+		 * Clear falling lines before raising the target so no two
+		 * pins are ever HIGH simultaneously.
+		 */
+		for (uint8_t i = 0; i < NUM_SELECT_LINES; i++) {
+			if ((prev_mask & BIT(i)) && !(target_mask & BIT(i))) {
+				ret = gpio_pin_set_dt(&select_lines[i], 0);
+				if (ret < 0) {
+					LOG_ERR("Failed to clear jtag-select%u: %d",
+						i, ret);
+					return ret;
+				}
+			}
+		}
+		for (uint8_t i = 0; i < NUM_SELECT_LINES; i++) {
+			if ((target_mask & BIT(i)) && !(prev_mask & BIT(i))) {
+				ret = gpio_pin_set_dt(&select_lines[i], 1);
+				if (ret < 0) {
+					LOG_ERR("Failed to set jtag-select%u: %d",
+						i, ret);
+					restore_mask_locked(prev_mask);
+					return ret;
+				}
+			}
+		}
+	}
+
+	/*
+	 * Single verification pass over every pin. In deferred-verification
+	 * mode the readbacks are skipped and the periodic auditor covers
+	 * fault detection, halving the driver round-trips per switch.
+	 */
+	if (!atomic_get(&deferred_verify)) {
+		for (uint8_t i = 0; i < NUM_SELECT_LINES; i++) {
+			ret = verify_gpio_state(i, (target_mask >> i) & 1);
+			if (ret < 0) {
+				/* ROLLBACK: restore the pre-transition state */
+				restore_mask_locked(prev_mask);
+				return ret;
+			}
+		}
 	}
 
-	/* Verify select1 configured correctly */
-	ret = verify_gpio_state(&jtag_select1, 0, "select1");
+	select_state_mask = target_mask;
+
+	record_latency(k_cycle_get_32() - actuation_start);
+
+	if (target_mask != prev_mask) {
+		record_event(mask_to_state(prev_mask), target);
+		schedule_state_save();
+	}
+
+	/* Fast mode: the event ring above is the only per-op record */
+	if (!atomic_get(&fast_mode)) {
+		LOG_DBG("Switch state set: mask=0x%02x", target_mask);
+	}
+
+	notify_state_change();
+
+	return 0;
+}
+
+int gpio_control_set_state(enum jtag_switch_state state)
+{
+	SCOPED_LOCK(gpio_control_mutex);  /* Auto-unlocks on return */
+
+	if (!initialized) {
+		LOG_ERR("GPIO control not initialized");
+		return -EINVAL;
+	}
+
+	if ((unsigned int)state > NUM_SELECT_LINES) {
+		LOG_ERR("Invalid switch state: %d", state);
+		return -EINVAL;
+	}
+
+	return apply_state_locked(state);  /* Mutex auto-unlocks here */
+}
+
+int gpio_control_get_state(enum jtag_switch_state *state)
+{
+	SCOPED_LOCK(gpio_control_mutex);  /* Auto-unlocks on return */
+
+	if (!initialized || state == NULL) {
+		return -EINVAL;
+	}
+
+	*state = mask_to_state(select_state_mask);
+
+	return 0;
+}
+
+int gpio_control_num_select_lines(void)
+{
+	return NUM_SELECT_LINES;
+}
+
+int gpio_control_set_select(uint8_t select_line, bool state)
+{
+	enum jtag_switch_state target;
+
+	SCOPED_LOCK(gpio_control_mutex);  /* Auto-unlocks on return */
+
+	if (!initialized) {
+		LOG_ERR("GPIO control not initialized");
+		return -EINVAL;
+	}
+
+	if (select_line >= NUM_SELECT_LINES) {
+		LOG_ERR("Invalid select line: %d", select_line);
+		return -EINVAL;
+	}
+
+	/*
+	 * Map the per-line request onto the state model. Raising a line
+	 * selects its connector (implicitly clearing every other line);
+	 * clearing a line falls back to whatever line remains selected.
+	 */
+	if (state) {
+		target = (enum jtag_switch_state)(select_line + 1);
+	} else {
+		target = mask_to_state(select_state_mask & ~BIT(select_line));
+	}
+
+	return apply_state_locked(target);  /* Mutex auto-unlocks here */
+}
+
+int gpio_control_get_select(uint8_t select_line, bool *state)
+{
+	SCOPED_LOCK(gpio_control_mutex);  /* Auto-unlocks on return */
+
+	if (!initialized || state == NULL) {
+		return -EINVAL;
+	}
+
+	if (select_line >= NUM_SELECT_LINES) {
+		return -EINVAL;
+	}
+
+	*state = (select_state_mask & BIT(select_line)) != 0;
+
+	return 0;
+}
+
+int gpio_control_toggle_select(uint8_t select_line)
+{
+	bool current_state;
+	int ret;
+
+	ret = gpio_control_get_select(select_line, &current_state);
 	if (ret < 0) {
 		return ret;
 	}
 
-	select0_state = false;
-	select1_state = false;
-	initialized = true;
+	return gpio_control_set_select(select_line, !current_state);
+}
 
-	LOG_INF("GPIO control initialized:");
-	LOG_INF("  jtag-select0: %s pin %d",
-		jtag_select0.port->name, jtag_select0.pin);
-	LOG_INF("  jtag-select1: %s pin %d",
-		jtag_select1.port->name, jtag_select1.pin);
+/*
+ * One outstanding scheduled switch, protected by gpio_control_mutex.
+ * A new schedule replaces the previous one. The deferred operation is
+ * either a ternary state (shell) or a per-line set (REST), resolved at
+ * fire time so a per-line request sees the state current at the deadline.
+ */
+static struct {
+	bool is_line_op;
+	uint8_t select_line;
+	bool line_state;
+	enum jtag_switch_state state;
+} scheduled_op;
 
-	return 0;  /* Mutex auto-unlocks here */
+static void schedule_work_handler(struct k_work *work)
+{
+	int ret;
+
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&gpio_control_mutex, K_FOREVER);
+	gpio_control_set_event_source(GPIO_CONTROL_SRC_INTERNAL);
+	if (scheduled_op.is_line_op) {
+		ret = gpio_control_set_select(scheduled_op.select_line,
+					      scheduled_op.line_state);
+	} else {
+		ret = gpio_control_set_state(scheduled_op.state);
+	}
+	k_mutex_unlock(&gpio_control_mutex);
+
+	if (ret < 0) {
+		LOG_ERR("Scheduled switch failed: %d", ret);
+	}
 }
 
-int gpio_control_set_select(uint8_t select_line, bool state)
+/*
+ * The delayed work item expires with kernel timer resolution and runs on
+ * the system workqueue (cooperative priority), so the switch instant does
+ * not depend on network thread scheduling.
+ */
+static K_WORK_DELAYABLE_DEFINE(schedule_work, schedule_work_handler);
+
+int gpio_control_schedule_state(enum jtag_switch_state state, int64_t at_ms)
 {
-	int ret = 0;
-	const struct gpio_dt_spec *gpio_spec;
-	const struct gpio_dt_spec *other_gpio_spec;
-	bool *state_var;
-	bool *other_state_var;
-	uint8_t other_line;
-	bool other_pin_cleared = false;
-	bool original_other_state;
+	SCOPED_LOCK(gpio_control_mutex);  /* Auto-unlocks on return */
+
+	if (!initialized) {
+		LOG_ERR("GPIO control not initialized");
+		return -EINVAL;
+	}
+
+	if ((unsigned int)state > NUM_SELECT_LINES) {
+		LOG_ERR("Invalid switch state: %d", state);
+		return -EINVAL;
+	}
 
+	scheduled_op.is_line_op = false;
+	scheduled_op.state = state;
+	k_work_reschedule(&schedule_work, K_TIMEOUT_ABS_MS(at_ms));
+
+	LOG_DBG("Scheduled state %d at uptime %lld ms", state, at_ms);
+
+	return 0;
+}
+
+int gpio_control_schedule_select(uint8_t select_line, bool state, int64_t at_ms)
+{
 	SCOPED_LOCK(gpio_control_mutex);  /* Auto-unlocks on return */
 
 	if (!initialized) {
@@ -175,129 +764,520 @@ int gpio_control_set_select(uint8_t select_line, bool state)
 		return -EINVAL;
 	}
 
-	switch (select_line) {
-	case 0:
-		gpio_spec = &jtag_select0;
-		state_var = &select0_state;
-		other_gpio_spec = &jtag_select1;
-		other_state_var = &select1_state;
-		other_line = 1;
-		break;
-	case 1:
-		gpio_spec = &jtag_select1;
-		state_var = &select1_state;
-		other_gpio_spec = &jtag_select0;
-		other_state_var = &select0_state;
-		other_line = 0;
-		break;
-	default:
+	if (select_line >= NUM_SELECT_LINES) {
 		LOG_ERR("Invalid select line: %d", select_line);
 		return -EINVAL;
 	}
 
+	scheduled_op.is_line_op = true;
+	scheduled_op.select_line = select_line;
+	scheduled_op.line_state = state;
+	k_work_reschedule(&schedule_work, K_TIMEOUT_ABS_MS(at_ms));
+
+	LOG_DBG("Scheduled select%d=%d at uptime %lld ms",
+		select_line, state ? 1 : 0, at_ms);
+
+	return 0;
+}
+
+int gpio_control_schedule_cancel(void)
+{
+	if (k_work_cancel_delayable(&schedule_work) == 0) {
+		return -ENOENT;  /* Nothing was scheduled */
+	}
+
+	return 0;
+}
+
+int gpio_control_batch(const struct gpio_control_batch_op *ops, size_t count)
+{
+	int ret = 0;
+
 	/*
-	 * SAFETY: Enforce mutual exclusion constraint
-	 * Both GPIO pins must NEVER be HIGH simultaneously.
-	 * If setting this line HIGH while other is HIGH, clear other first.
+	 * Hold the mutex across the whole sequence. k_mutex is recursive, so
+	 * the per-operation locking inside gpio_control_set_select() and
+	 * gpio_control_toggle_select() nests without blocking, and no other
+	 * thread can interleave between the steps.
 	 */
-	if (state == true && *other_state_var == true) {
-		LOG_WRN("Mutual exclusion: clearing select%d before setting select%d HIGH",
-		        other_line, select_line);
+	SCOPED_LOCK(gpio_control_mutex);  /* Auto-unlocks on return */
 
-		original_other_state = *other_state_var;
+	if (!initialized || ops == NULL || count == 0) {
+		return -EINVAL;
+	}
 
-		ret = gpio_pin_set_dt(other_gpio_spec, 0);
-		if (ret < 0) {
-			LOG_ERR("Failed to clear jtag-select%d: %d", other_line, ret);
-			return ret;
+	for (size_t i = 0; i < count; i++) {
+		switch (ops[i].op) {
+		case GPIO_CONTROL_OP_SET:
+			ret = gpio_control_set_select(ops[i].select_line,
+						      ops[i].state);
+			break;
+		case GPIO_CONTROL_OP_TOGGLE:
+			ret = gpio_control_toggle_select(ops[i].select_line);
+			break;
+		default:
+			LOG_ERR("Invalid batch op %d at index %u",
+				ops[i].op, (unsigned int)i);
+			ret = -EINVAL;
+			break;
 		}
 
-		/* Verify other pin cleared */
-		ret = verify_gpio_state(other_gpio_spec, 0,
-		                        select_line == 0 ? "select1" : "select0");
 		if (ret < 0) {
+			LOG_ERR("Batch aborted at step %u: %d",
+				(unsigned int)i, ret);
 			return ret;
 		}
+	}
+
+	return 0;  /* Mutex auto-unlocks here */
+}
+
+/* ========== Actuation Thread ========== */
+
+/*
+ * Dedicated actuation thread. A switch executed directly in a transport's
+ * context inherits that transport's scheduling: the HTTP server runs at
+ * CONFIG_NET_RX_DEFAULT_PRIORITY (5) and shares the CPU with TCP
+ * processing, so the actuation instant jitters with network load.
+ * Submitted requests are instead queued to this cooperative-priority
+ * thread, which performs the pin writes immune to preemption by the
+ * network stack; the submitter optionally blocks on a completion slot
+ * for the result. The direct setters stay valid for callers that need
+ * in-context execution (batch atomicity, the scheduled-op work handler);
+ * gpio_control_mutex still serializes them against this thread.
+ */
+
+#define ACTUATION_THREAD_STACK_SIZE 2048
+/* Cooperative: runs to completion ahead of every preemptive thread */
+#define ACTUATION_THREAD_PRIORITY K_PRIO_COOP(4)
+#define ACTUATION_QUEUE_DEPTH 8
+/* One blocking waiter per HTTP client, plus the UDP listener and shell */
+#define ACTUATION_REQ_SLOTS (CONFIG_HTTP_SERVER_MAX_CLIENTS + 2)
+
+enum actuation_op {
+	ACTUATION_OP_STATE,
+	ACTUATION_OP_SET,
+	ACTUATION_OP_TOGGLE,
+};
 
-		*other_state_var = false;
-		other_pin_cleared = true;
-		LOG_DBG("jtag-select%d cleared to LOW", other_line);
+/*
+ * Completion slot life cycle. Transitions are atomic compare-and-swaps,
+ * so a submitter timing out races safely against the thread finishing:
+ * whichever side moves the slot out of CLAIMED first owns the cleanup.
+ */
+enum actuation_req_state {
+	ACTUATION_REQ_FREE,      /* Available for a submitter to claim */
+	ACTUATION_REQ_CLAIMED,   /* Submitter is waiting on the semaphore */
+	ACTUATION_REQ_DONE,      /* Result written, semaphore given */
+	ACTUATION_REQ_ORPHANED,  /* Submitter timed out; the thread frees */
+};
+
+struct actuation_req {
+	atomic_t state;
+	struct k_sem done;
+	int result;
+};
+
+static struct actuation_req actuation_reqs[ACTUATION_REQ_SLOTS];
+
+struct actuation_msg {
+	uint8_t op;                 /* enum actuation_op */
+	uint8_t select_line;        /* ACTUATION_OP_SET / _TOGGLE */
+	bool line_state;            /* ACTUATION_OP_SET */
+	uint8_t state;              /* ACTUATION_OP_STATE */
+	uint8_t source;             /* enum gpio_control_event_source */
+	struct actuation_req *req;  /* NULL = fire-and-forget */
+};
+
+K_MSGQ_DEFINE(actuation_msgq, sizeof(struct actuation_msg),
+	      ACTUATION_QUEUE_DEPTH, 4);
+
+/**
+ * @brief Claim a free completion slot
+ *
+ * k_sem_init() doubles as the reset of a slot previously completed after
+ * its submitter timed out, so no init-ordering against the thread exists.
+ */
+static struct actuation_req *actuation_req_claim(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(actuation_reqs); i++) {
+		struct actuation_req *req = &actuation_reqs[i];
+
+		if (atomic_cas(&req->state, ACTUATION_REQ_FREE,
+			       ACTUATION_REQ_CLAIMED)) {
+			k_sem_init(&req->done, 0, 1);
+			return req;
+		}
 	}
 
-	/* Set the requested line to desired state */
-	ret = gpio_pin_set_dt(gpio_spec, state ? 1 : 0);
-	if (ret < 0) {
-		LOG_ERR("Failed to set jtag-select%d: %d", select_line, ret);
-
-		/* ROLLBACK: Restore other pin if we cleared it */
-		if (other_pin_cleared) {
-			int rollback_ret = gpio_pin_set_dt(other_gpio_spec,
-			                                   original_other_state ? 1 : 0);
-			if (rollback_ret == 0) {
-				*other_state_var = original_other_state;
-				LOG_WRN("Rolled back select%d to original state", other_line);
-			} else {
-				LOG_ERR("CRITICAL: Rollback failed for select%d: %d",
-				        other_line, rollback_ret);
+	return NULL;
+}
+
+static void actuation_thread_fn(void *p1, void *p2, void *p3)
+{
+	struct actuation_msg msg;
+	int ret;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (1) {
+		k_msgq_get(&actuation_msgq, &msg, K_FOREVER);
+
+		/* Tag the event with the source captured at submit time */
+		gpio_control_set_event_source(
+			(enum gpio_control_event_source)msg.source);
+
+		switch (msg.op) {
+		case ACTUATION_OP_STATE:
+			ret = gpio_control_set_state(
+				(enum jtag_switch_state)msg.state);
+			break;
+		case ACTUATION_OP_SET:
+			ret = gpio_control_set_select(msg.select_line,
+						      msg.line_state);
+			break;
+		case ACTUATION_OP_TOGGLE:
+			ret = gpio_control_toggle_select(msg.select_line);
+			break;
+		default:
+			ret = -EINVAL;
+			break;
+		}
+
+		if (msg.req == NULL) {
+			/* Fire-and-forget: the log is the only feedback */
+			if (ret < 0) {
+				LOG_ERR("Queued switch failed: %d", ret);
 			}
+			continue;
+		}
+
+		msg.req->result = ret;
+		if (atomic_cas(&msg.req->state, ACTUATION_REQ_CLAIMED,
+			       ACTUATION_REQ_DONE)) {
+			k_sem_give(&msg.req->done);
+		} else {
+			/* Submitter timed out and orphaned the slot */
+			atomic_set(&msg.req->state, ACTUATION_REQ_FREE);
 		}
-		return ret;
 	}
+}
+
+K_THREAD_DEFINE(actuation_thread, ACTUATION_THREAD_STACK_SIZE,
+		actuation_thread_fn, NULL, NULL, NULL,
+		ACTUATION_THREAD_PRIORITY, 0, 0);
 
-	/* Verify target pin set correctly */
-	ret = verify_gpio_state(gpio_spec, state ? 1 : 0,
-	                        select_line == 0 ? "select0" : "select1");
+/**
+ * @brief Queue one request and optionally wait for its completion
+ *
+ * With K_NO_WAIT the request is queued fire-and-forget. Otherwise a
+ * completion slot is claimed and the call blocks until the actuation
+ * thread has executed the request or the timeout expires; a timed-out
+ * request still executes, and its slot is reclaimed by the thread.
+ */
+static int actuation_submit(struct actuation_msg *msg, k_timeout_t timeout)
+{
+	struct actuation_req *req;
+	int ret;
+
+	msg->source = (uint8_t)atomic_get(&current_event_source);
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		msg->req = NULL;
+		ret = k_msgq_put(&actuation_msgq, msg, K_NO_WAIT);
+		return (ret < 0) ? -ENOMSG : 0;
+	}
+
+	req = actuation_req_claim();
+	if (req == NULL) {
+		return -EBUSY;
+	}
+
+	msg->req = req;
+	ret = k_msgq_put(&actuation_msgq, msg, K_NO_WAIT);
 	if (ret < 0) {
-		/* ROLLBACK: Restore other pin if we cleared it */
-		if (other_pin_cleared) {
-			int rollback_ret = gpio_pin_set_dt(other_gpio_spec,
-			                                   original_other_state ? 1 : 0);
-			if (rollback_ret == 0) {
-				*other_state_var = original_other_state;
-				LOG_WRN("Rolled back select%d after verification failure", other_line);
-			}
-		}
+		atomic_set(&req->state, ACTUATION_REQ_FREE);
+		return -ENOMSG;
+	}
+
+	if (k_sem_take(&req->done, timeout) == 0) {
+		ret = req->result;
+		atomic_set(&req->state, ACTUATION_REQ_FREE);
 		return ret;
 	}
 
-	*state_var = state;
-	LOG_DBG("jtag-select%d set to %s (connector %d)",
-	        select_line, state ? "HIGH" : "LOW", state ? 1 : 0);
+	/* Timed out; hand the slot to the thread, unless the request
+	 * completed in the meantime and the result is already there.
+	 */
+	if (atomic_cas(&req->state, ACTUATION_REQ_CLAIMED,
+		       ACTUATION_REQ_ORPHANED)) {
+		return -ETIMEDOUT;
+	}
+
+	ret = req->result;
+	atomic_set(&req->state, ACTUATION_REQ_FREE);
+	return ret;
+}
 
-	return 0;  /* Mutex auto-unlocks here */
+int gpio_control_submit_state(enum jtag_switch_state state, k_timeout_t timeout)
+{
+	struct actuation_msg msg = {
+		.op = ACTUATION_OP_STATE,
+		.state = (uint8_t)state,
+	};
+
+	if (!initialized) {
+		return -EINVAL;
+	}
+
+	if ((unsigned int)state > NUM_SELECT_LINES) {
+		LOG_ERR("Invalid switch state: %d", state);
+		return -EINVAL;
+	}
+
+	return actuation_submit(&msg, timeout);
 }
 
-int gpio_control_get_select(uint8_t select_line, bool *state)
+int gpio_control_submit_select(uint8_t select_line, bool state,
+			       k_timeout_t timeout)
 {
-	SCOPED_LOCK(gpio_control_mutex);  /* Auto-unlocks on return */
+	struct actuation_msg msg = {
+		.op = ACTUATION_OP_SET,
+		.select_line = select_line,
+		.line_state = state,
+	};
 
-	if (!initialized || state == NULL) {
+	if (!initialized) {
 		return -EINVAL;
 	}
 
-	switch (select_line) {
-	case 0:
-		*state = select0_state;
-		break;
-	case 1:
-		*state = select1_state;
-		break;
-	default:
+	if (select_line >= NUM_SELECT_LINES) {
+		LOG_ERR("Invalid select line: %d", select_line);
+		return -EINVAL;
+	}
+
+	return actuation_submit(&msg, timeout);
+}
+
+int gpio_control_submit_toggle(uint8_t select_line, k_timeout_t timeout)
+{
+	struct actuation_msg msg = {
+		.op = ACTUATION_OP_TOGGLE,
+		.select_line = select_line,
+	};
+
+	if (!initialized) {
+		return -EINVAL;
+	}
+
+	if (select_line >= NUM_SELECT_LINES) {
+		LOG_ERR("Invalid select line: %d", select_line);
 		return -EINVAL;
 	}
 
+	return actuation_submit(&msg, timeout);
+}
+
+void gpio_control_set_event_source(enum gpio_control_event_source source)
+{
+	atomic_set(&current_event_source, source);
+}
+
+void gpio_control_set_fast_mode(bool enable)
+{
+	atomic_set(&fast_mode, enable ? 1 : 0);
+	LOG_INF("Fast-switch mode %s", enable ? "enabled" : "disabled");
+}
+
+bool gpio_control_get_fast_mode(void)
+{
+	return atomic_get(&fast_mode) != 0;
+}
+
+int gpio_control_set_log_level(int level)
+{
+#ifdef CONFIG_LOG_RUNTIME_FILTERING
+	if (level < LOG_LEVEL_NONE || level > LOG_LEVEL_DBG) {
+		return -EINVAL;
+	}
+
+	log_filter_set(NULL, Z_LOG_LOCAL_DOMAIN_ID,
+		       log_source_id_get(STRINGIFY(gpio_control)),
+		       (uint32_t)level);
 	return 0;
+#else
+	ARG_UNUSED(level);
+	return -ENOTSUP;
+#endif
 }
 
-int gpio_control_toggle_select(uint8_t select_line)
+/* ========== Deferred Verification ========== */
+
+/* Audit cadence: one readback pass per period, off the switching path */
+#define VERIFY_AUDIT_PERIOD_MS 1000
+
+/**
+ * @brief Periodic auditor comparing pin readback against the shadow mask
+ *
+ * Runs on the system workqueue while deferred-verification mode is
+ * active. A mismatch raises the mismatch counter, an error log line and
+ * an event-log entry recording the expected and observed states; the
+ * pins are not rewritten here - the next switch reasserts every line
+ * anyway, and a fault that persists keeps counting.
+ */
+static void verify_audit_work_handler(struct k_work *work)
 {
-	bool current_state;
-	int ret;
+	if (!atomic_get(&deferred_verify)) {
+		return;  /* Mode was disabled while the work was queued */
+	}
 
-	ret = gpio_control_get_select(select_line, &current_state);
-	if (ret < 0) {
-		return ret;
+#ifdef CONFIG_GPIO_EMUL
+	/* No readback support in simulation; keep only the cadence */
+#else
+	uint8_t actual_mask = 0;
+	uint8_t expected_mask;
+	bool read_ok = true;
+
+	k_mutex_lock(&gpio_control_mutex, K_FOREVER);
+
+	expected_mask = select_state_mask;
+	for (uint8_t i = 0; i < NUM_SELECT_LINES; i++) {
+		const int val = gpio_pin_get_dt(&select_lines[i]);
+
+		if (val < 0) {
+			LOG_ERR("Audit failed to read select%u: %d", i, val);
+			read_ok = false;
+			break;
+		}
+		if (val) {
+			actual_mask |= BIT(i);
+		}
 	}
 
-	return gpio_control_set_select(select_line, !current_state);
+	if (read_ok && actual_mask != expected_mask) {
+		atomic_inc(&verify_mismatch_count);
+		LOG_ERR("Audit mismatch: expected mask 0x%02x, read 0x%02x",
+			expected_mask, actual_mask);
+		gpio_control_set_event_source(GPIO_CONTROL_SRC_INTERNAL);
+		record_event(mask_to_state(expected_mask),
+			     mask_to_state(actual_mask));
+	}
+
+	k_mutex_unlock(&gpio_control_mutex);
+#endif /* CONFIG_GPIO_EMUL */
+
+	k_work_schedule(k_work_delayable_from_work(work),
+			K_MSEC(VERIFY_AUDIT_PERIOD_MS));
+}
+
+static K_WORK_DELAYABLE_DEFINE(verify_audit_work, verify_audit_work_handler);
+
+void gpio_control_set_deferred_verify(bool enable)
+{
+	atomic_set(&deferred_verify, enable ? 1 : 0);
+
+	if (enable) {
+		k_work_schedule(&verify_audit_work,
+				K_MSEC(VERIFY_AUDIT_PERIOD_MS));
+	} else {
+		k_work_cancel_delayable(&verify_audit_work);
+	}
+
+	LOG_INF("Deferred verification %s", enable ? "enabled" : "disabled");
+}
+
+bool gpio_control_get_deferred_verify(void)
+{
+	return atomic_get(&deferred_verify) != 0;
+}
+
+uint32_t gpio_control_get_verify_mismatches(void)
+{
+	return (uint32_t)atomic_get(&verify_mismatch_count);
+}
+
+int gpio_control_get_events(uint32_t since_seq,
+			    struct gpio_control_event *events,
+			    size_t max_events, uint32_t *next_seq)
+{
+	const uint32_t newest = (uint32_t)atomic_get(&event_write_seq);
+	uint32_t first;
+	size_t count = 0;
+
+	if (events == NULL || max_events == 0) {
+		return -EINVAL;
+	}
+
+	if (next_seq != NULL) {
+		*next_seq = newest;
+	}
+
+	if (newest <= since_seq) {
+		return 0;  /* Nothing newer than the cursor */
+	}
+
+	/* Oldest event still guaranteed to be in the ring */
+	first = (newest > GPIO_CONTROL_EVENT_RING_SIZE) ?
+		(newest - GPIO_CONTROL_EVENT_RING_SIZE + 1) : 1;
+	if (since_seq + 1 > first) {
+		first = since_seq + 1;
+	}
+
+	for (uint32_t seq = first; seq <= newest && count < max_events; seq++) {
+		const struct gpio_control_event *slot =
+			&event_ring[seq & (GPIO_CONTROL_EVENT_RING_SIZE - 1)];
+
+		events[count] = *slot;
+		if (events[count].seq != seq) {
+			/* Producer lapped us mid-copy; entry is lost */
+			continue;
+		}
+		count++;
+	}
+
+	return (int)count;
+}
+
+int gpio_control_get_latency_stats(struct gpio_control_latency_stats *stats)
+{
+	SCOPED_LOCK(gpio_control_mutex);  /* Auto-unlocks on return */
+
+	if (stats == NULL) {
+		return -EINVAL;
+	}
+
+	stats->count = latency_hist.count;
+	stats->min_cycles = (latency_hist.count > 0) ? latency_hist.min_cycles : 0;
+	stats->max_cycles = latency_hist.max_cycles;
+	stats->p50_cycles = latency_percentile(50);
+	stats->p99_cycles = latency_percentile(99);
+	memcpy(stats->buckets, latency_hist.buckets, sizeof(stats->buckets));
+
+	return 0;
+}
+
+void gpio_control_reset_latency_stats(void)
+{
+	SCOPED_LOCK(gpio_control_mutex);  /* Auto-unlocks on return */
+
+	memset(&latency_hist, 0, sizeof(latency_hist));
+	latency_hist.min_cycles = UINT32_MAX;
+}
+
+int gpio_control_register_change_cb(gpio_control_change_cb_t cb)
+{
+	SCOPED_LOCK(gpio_control_mutex);  /* Auto-unlocks on return */
+
+	if (cb == NULL) {
+		return -EINVAL;
+	}
+
+	if (num_change_callbacks >= MAX_CHANGE_CALLBACKS) {
+		LOG_ERR("No free change callback slots");
+		return -ENOMEM;
+	}
+
+	change_callbacks[num_change_callbacks++] = cb;
+	return 0;
 }
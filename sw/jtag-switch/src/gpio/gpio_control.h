@@ -9,6 +9,79 @@
 #include <zephyr/kernel.h>
 #include <stdbool.h>
 
+/**
+ * @brief State-change notification callback
+ *
+ * Called after a select line successfully changes state. Callbacks run in
+ * the context of the thread that performed the change and must be short;
+ * defer any real work (e.g. network I/O) to a work queue.
+ */
+typedef void (*gpio_control_change_cb_t)(void);
+
+/*
+ * Upper bound on select lines; the actual count comes from the number of
+ * contiguous jtag-selectN device tree aliases the board defines (2 on the
+ * current FRDM boards, up to 8 on cascaded-mux designs). Per-line state
+ * packs into one uint8_t bitmask, so extra lines cost no RAM.
+ */
+#define GPIO_CONTROL_MAX_SELECT_LINES 8
+
+/**
+ * @brief The legal switch states
+ *
+ * The multiplexer's legal states are "off" and "exactly one line HIGH",
+ * modelled directly so prohibited multi-line combinations are
+ * unrepresentable at the API level. State N selects line N-1; boards with
+ * more than two lines address the extra connectors numerically
+ * (JTAG_STATE_CONN0 + line).
+ */
+enum jtag_switch_state {
+	JTAG_STATE_OFF,    /* All select lines LOW */
+	JTAG_STATE_CONN0,  /* Select0 HIGH, all others LOW */
+	JTAG_STATE_CONN1,  /* Select1 HIGH, all others LOW */
+};
+
+/**
+ * @brief Batch operation types
+ */
+enum gpio_control_batch_op_type {
+	GPIO_CONTROL_OP_SET,     /* Set a select line to an explicit state */
+	GPIO_CONTROL_OP_TOGGLE,  /* Toggle a select line */
+};
+
+/**
+ * @brief Single operation within a batch
+ */
+struct gpio_control_batch_op {
+	enum gpio_control_batch_op_type op;
+	uint8_t select_line;  /* Select line index */
+	bool state;           /* Target state (GPIO_CONTROL_OP_SET only) */
+};
+
+/**
+ * @brief Origin of a switch-state change, for the event log
+ */
+enum gpio_control_event_source {
+	GPIO_CONTROL_SRC_INTERNAL,  /* Boot default, scheduled op, etc. */
+	GPIO_CONTROL_SRC_SHELL,
+	GPIO_CONTROL_SRC_REST,
+	GPIO_CONTROL_SRC_UDP,
+};
+
+/**
+ * @brief One recorded switch-state change
+ */
+struct gpio_control_event {
+	uint32_t seq;        /* Monotonic sequence number, starts at 1 */
+	int64_t uptime_ms;   /* k_uptime_get() at the time of the change */
+	uint8_t old_state;   /* enum jtag_switch_state before the change */
+	uint8_t new_state;   /* enum jtag_switch_state after the change */
+	uint8_t source;      /* enum gpio_control_event_source */
+};
+
+/* Ring capacity; the newest events win when a reader falls behind */
+#define GPIO_CONTROL_EVENT_RING_SIZE 32
+
 /**
  * @brief Initialize GPIO control subsystem
  *
@@ -22,34 +95,97 @@ int gpio_control_init(void);
 /**
  * @brief Set JTAG select line state with mutual exclusion enforcement
  *
- * Controls one of the two JTAG connector select lines.
- * Each line independently selects between connector 0 (low) and connector 1 (high).
- *
- * SAFETY CONSTRAINT: Both GPIO pins must NEVER be HIGH simultaneously.
- * Acceptable states:
- *   - Both LOW (00)
- *   - Select0 HIGH, Select1 LOW (10)
- *   - Select0 LOW, Select1 HIGH (01)
- * Prohibited state:
- *   - Both HIGH (11) - HARDWARE SAFETY VIOLATION
+ * Controls one of the JTAG connector select lines.
  *
- * When setting a line HIGH while the other is already HIGH, this function will
- * automatically clear the other line first before setting the requested line HIGH.
- * A warning will be logged when this occurs.
+ * SAFETY CONSTRAINT: At most ONE select GPIO pin may be HIGH at any time;
+ * all lines form a single mutual-exclusion group. Raising a line
+ * automatically clears any other raised line first, so no two pins are
+ * ever HIGH simultaneously, not even transiently.
  *
- * @param select_line Select line number (0 or 1)
- * @param state false = connector 0 (LOW), true = connector 1 (HIGH)
+ * @param select_line Select line index (0 .. lines-1)
+ * @param state false = line LOW, true = line HIGH (selects its connector)
  * @return 0 on success, negative errno on failure
  */
 int gpio_control_set_select(uint8_t select_line, bool state);
 
+/**
+ * @brief Set the switch to one of the legal states
+ *
+ * Core actuation primitive: performs the whole transition as a single
+ * locked operation with one verification pass, so any state-to-state
+ * change costs one call instead of a clear-then-set pair. The per-line
+ * setters are implemented on top of this.
+ *
+ * @param state Target switch state
+ * @return 0 on success, negative errno on failure
+ */
+int gpio_control_set_state(enum jtag_switch_state state);
+
+/**
+ * @brief Get the current switch state
+ *
+ * Returns the last commanded state (not read from hardware).
+ *
+ * @param state Pointer to store the current state
+ * @return 0 on success, negative errno on failure
+ */
+int gpio_control_get_state(enum jtag_switch_state *state);
+
+/**
+ * @brief Number of select lines the board defines
+ *
+ * Fixed at compile time from the jtag-selectN device tree aliases.
+ *
+ * @return Select line count (2 .. GPIO_CONTROL_MAX_SELECT_LINES)
+ */
+int gpio_control_num_select_lines(void);
+
+/**
+ * @brief Schedule a switch-state change at an absolute uptime deadline
+ *
+ * Arms a kernel-timed deferred operation that applies the given state when
+ * k_uptime reaches @p at_ms, then returns immediately. The switch instant
+ * depends only on kernel timer resolution, not on the latency of the
+ * transport that delivered the request. A deadline in the past fires
+ * immediately. Only one scheduled operation can be outstanding; a new
+ * schedule replaces the previous one.
+ *
+ * @param state Target switch state
+ * @param at_ms Absolute deadline in milliseconds of uptime (k_uptime_get)
+ * @return 0 on success, negative errno on failure
+ */
+int gpio_control_schedule_state(enum jtag_switch_state state, int64_t at_ms);
+
+/**
+ * @brief Schedule a per-line set at an absolute uptime deadline
+ *
+ * Per-line variant of gpio_control_schedule_state(). The line request is
+ * resolved against the state of the other lines at fire time, not at
+ * schedule time, exactly as if gpio_control_set_select() were called at
+ * the deadline.
+ *
+ * @param select_line Select line index (0 .. lines-1)
+ * @param state false = line LOW, true = line HIGH
+ * @param at_ms Absolute deadline in milliseconds of uptime (k_uptime_get)
+ * @return 0 on success, negative errno on failure
+ */
+int gpio_control_schedule_select(uint8_t select_line, bool state, int64_t at_ms);
+
+/**
+ * @brief Cancel a pending scheduled switch
+ *
+ * @return 0 if a pending operation was cancelled, -ENOENT if none was
+ *         scheduled (or it already fired)
+ */
+int gpio_control_schedule_cancel(void);
+
 /**
  * @brief Get current JTAG select line state
  *
  * Returns the last set state of the select line (not read from hardware).
  *
- * @param select_line Select line number (0 or 1)
- * @param state Pointer to store current state (false = connector 0, true = connector 1)
+ * @param select_line Select line index (0 .. lines-1)
+ * @param state Pointer to store current state (false = LOW, true = HIGH)
  * @return 0 on success, negative errno on failure
  */
 int gpio_control_get_select(uint8_t select_line, bool *state);
@@ -57,11 +193,221 @@ int gpio_control_get_select(uint8_t select_line, bool *state);
 /**
  * @brief Toggle JTAG select line
  *
- * Toggles the specified select line between connector 0 and connector 1.
+ * Toggles the specified select line between LOW and HIGH.
  *
- * @param select_line Select line number (0 or 1)
+ * @param select_line Select line index (0 .. lines-1)
  * @return 0 on success, negative errno on failure
  */
 int gpio_control_toggle_select(uint8_t select_line);
 
+/**
+ * @brief Switch-latency histogram
+ *
+ * Actuation latency of gpio_control_set_select() (pin writes plus readback
+ * verification) measured with k_cycle_get_32(). Samples are accumulated
+ * into power-of-two cycle buckets: bucket i counts samples with
+ * 2^i <= cycles < 2^(i+1), with the last bucket catching overflows.
+ */
+#define GPIO_CONTROL_LATENCY_BUCKETS 24
+
+struct gpio_control_latency_stats {
+	uint32_t count;       /* Total samples recorded */
+	uint32_t min_cycles;  /* Fastest observed switch */
+	uint32_t max_cycles;  /* Slowest observed switch */
+	uint32_t p50_cycles;  /* Median (bucket upper bound) */
+	uint32_t p99_cycles;  /* 99th percentile (bucket upper bound) */
+	uint32_t buckets[GPIO_CONTROL_LATENCY_BUCKETS];
+};
+
+/**
+ * @brief Execute a sequence of operations atomically
+ *
+ * Executes the given operations in order while holding the internal mutex
+ * for the whole sequence, so no other caller can interleave between steps.
+ * Execution stops at the first failing operation.
+ *
+ * The mutual exclusion constraint (see gpio_control_set_select) is
+ * enforced for every step of the sequence.
+ *
+ * @param ops Array of operations to execute
+ * @param count Number of operations in the array
+ * @return 0 on success, negative errno of the first failing operation
+ */
+int gpio_control_batch(const struct gpio_control_batch_op *ops, size_t count);
+
+/**
+ * @brief Submit a switch-state change to the actuation thread
+ *
+ * Queues the request to the dedicated high-priority actuation thread
+ * instead of executing it in the caller's context, so the actuation
+ * instant does not inherit the caller's scheduling (e.g. network-stack
+ * jitter in the HTTP server thread). Requests execute in submission
+ * order.
+ *
+ * With @p timeout K_NO_WAIT the call is fire-and-forget: it returns 0
+ * once the request is queued, -ENOMSG if the queue is full. Any other
+ * timeout blocks until the request has executed, returning its result,
+ * or -ETIMEDOUT if the deadline passes first (the request still
+ * executes); -EBUSY means all completion slots are taken.
+ *
+ * @param state Target switch state
+ * @param timeout How long to wait for completion, or K_NO_WAIT
+ * @return Result of the executed operation, 0 for a queued
+ *         fire-and-forget request, or negative errno as above
+ */
+int gpio_control_submit_state(enum jtag_switch_state state, k_timeout_t timeout);
+
+/**
+ * @brief Submit a per-line set to the actuation thread
+ *
+ * Per-line variant of gpio_control_submit_state(), with the semantics of
+ * gpio_control_set_select() resolved when the request executes.
+ *
+ * @param select_line Select line index (0 .. lines-1)
+ * @param state false = line LOW, true = line HIGH
+ * @param timeout How long to wait for completion, or K_NO_WAIT
+ * @return See gpio_control_submit_state()
+ */
+int gpio_control_submit_select(uint8_t select_line, bool state,
+			       k_timeout_t timeout);
+
+/**
+ * @brief Submit a line toggle to the actuation thread
+ *
+ * Per-line variant of gpio_control_submit_state(), with the semantics of
+ * gpio_control_toggle_select() resolved when the request executes.
+ *
+ * @param select_line Select line index (0 .. lines-1)
+ * @param timeout How long to wait for completion, or K_NO_WAIT
+ * @return See gpio_control_submit_state()
+ */
+int gpio_control_submit_toggle(uint8_t select_line, k_timeout_t timeout);
+
+/**
+ * @brief Enable or disable fast-switch mode
+ *
+ * In fast mode the per-operation debug logging on the actuation path is
+ * skipped, so a timed test run pays zero deferred-logging cost per
+ * switch. The event ring, latency histogram and change callbacks are
+ * unaffected, so diagnostics remain available from /api/events and the
+ * metrics without the logging load.
+ *
+ * @param enable true to enable fast mode
+ */
+void gpio_control_set_fast_mode(bool enable);
+
+/**
+ * @brief Query fast-switch mode
+ *
+ * @return true if fast mode is enabled
+ */
+bool gpio_control_get_fast_mode(void);
+
+/**
+ * @brief Set the runtime log level of the gpio_control module
+ *
+ * Requires CONFIG_LOG_RUNTIME_FILTERING; without it the compile-time
+ * level stays in effect and -ENOTSUP is returned.
+ *
+ * @param level One of LOG_LEVEL_NONE..LOG_LEVEL_DBG (0..4)
+ * @return 0 on success, -EINVAL on a bad level, -ENOTSUP without
+ *         runtime filtering
+ */
+int gpio_control_set_log_level(int level);
+
+/**
+ * @brief Enable or disable deferred-verification ("fast-ack") mode
+ *
+ * With deferred verification the actuation path performs pure pin
+ * writes: the per-transition readback pass is skipped, halving the
+ * GPIO driver round-trips per switch. The safety net moves to a
+ * periodic low-priority auditor on the system workqueue that compares
+ * actual pin state against the shadow mask, raising an event-log entry
+ * and the mismatch counter on any deviation.
+ *
+ * @param enable true to defer verification to the auditor
+ */
+void gpio_control_set_deferred_verify(bool enable);
+
+/**
+ * @brief Query deferred-verification mode
+ *
+ * @return true if verification is deferred to the periodic auditor
+ */
+bool gpio_control_get_deferred_verify(void);
+
+/**
+ * @brief Number of audit mismatches detected since boot
+ *
+ * Counts auditor passes that found the pins deviating from the shadow
+ * state. Exposed as a counter in /api/metrics; any non-zero value
+ * means a hardware fault or external pin interference.
+ *
+ * @return Mismatch count
+ */
+uint32_t gpio_control_get_verify_mismatches(void);
+
+/**
+ * @brief Register a state-change notification callback
+ *
+ * Registers a callback invoked whenever a select line changes state.
+ * A small fixed number of slots is available; registration is permanent.
+ *
+ * @param cb Callback function to register
+ * @return 0 on success, -ENOMEM if all callback slots are in use
+ */
+int gpio_control_register_change_cb(gpio_control_change_cb_t cb);
+
+/**
+ * @brief Tag the source of the next switch-state change
+ *
+ * Call immediately before a state-changing operation so the resulting
+ * event log entries record where the command came from. The tag stays in
+ * effect until the next call, so every entry point must tag its own
+ * operations. Advisory only: it does not affect actuation.
+ *
+ * @param source Origin of the upcoming change
+ */
+void gpio_control_set_event_source(enum gpio_control_event_source source);
+
+/**
+ * @brief Read switch-state change events newer than a cursor
+ *
+ * Copies events with seq > @p since_seq, oldest first, into @p events.
+ * The ring keeps the newest GPIO_CONTROL_EVENT_RING_SIZE events; a
+ * reader that falls further behind silently loses the oldest entries
+ * (visible as a gap in seq). Lock-free: reads never block the actuation
+ * path.
+ *
+ * @param since_seq Return only events with a larger sequence number
+ * @param events Destination array
+ * @param max_events Capacity of the destination array
+ * @param next_seq If non-NULL, set to the newest sequence number, for
+ *                 use as the next cursor
+ * @return Number of events copied, or negative errno on failure
+ */
+int gpio_control_get_events(uint32_t since_seq,
+			    struct gpio_control_event *events,
+			    size_t max_events, uint32_t *next_seq);
+
+/**
+ * @brief Get switch-latency statistics
+ *
+ * Returns a snapshot of the actuation latency histogram. Percentiles are
+ * derived from the histogram buckets, so they are upper bounds accurate
+ * to the bucket resolution.
+ *
+ * @param stats Pointer to statistics structure to fill
+ * @return 0 on success, negative errno on failure
+ */
+int gpio_control_get_latency_stats(struct gpio_control_latency_stats *stats);
+
+/**
+ * @brief Reset switch-latency statistics
+ *
+ * Clears the latency histogram and min/max trackers, e.g. before a
+ * timed test run.
+ */
+void gpio_control_reset_latency_stats(void);
+
 #endif /* GPIO_CONTROL_H */
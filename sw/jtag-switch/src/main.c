@@ -6,6 +6,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/device.h>
 #include <zephyr/logging/log.h>
+#include "boot_timing.h"
 #include "gpio/gpio_control.h"
 
 #if defined(CONFIG_SHELL)
@@ -15,6 +16,8 @@
 #if defined(CONFIG_NETWORKING)
 #include "net/network_config.h"
 #include "net/http_api.h"
+#include "net/udp_control.h"
+#include "net/state_beacon.h"
 #endif
 
 
@@ -25,47 +28,70 @@ int main(void)
 	LOG_INF("JTAG Switch Application Starting");
 	LOG_INF("Board: %s", CONFIG_BOARD);
 
-	/* Initialize GPIO control */
+	/* Initialize GPIO control (includes the NVS state restore) */
+	boot_timing_phase_begin("gpio");
 	int ret = gpio_control_init();
 	if (ret < 0) {
 		LOG_ERR("Failed to initialize GPIO control: %d", ret);
 		return ret;
 	}
+	boot_timing_phase_end();
 
 	LOG_INF("GPIO control initialized successfully");
 
-	/* Set default configuration (both to connector 0) */
-	ret = gpio_control_set_select(0, false);
-	if (ret < 0) {
-		LOG_ERR("Failed to set jtag-select0: %d", ret);
-	}
-
-	ret = gpio_control_set_select(1, false);
-	if (ret < 0) {
-		LOG_ERR("Failed to set jtag-select1: %d", ret);
-	}
+	/*
+	 * No default is forced here: gpio_control_init() restores the
+	 * persisted switch state from NVS, falling back to both lines
+	 * LOW (connector 0) on first boot.
+	 */
 
 	/* USB device is automatically initialized when CONFIG_CDC_ACM_SERIAL_INITIALIZE_AT_BOOT=y */
 
 #if defined(CONFIG_NETWORKING)
-	/* Initialize network subsystem */
+	/* Initialize network subsystem (covers any DHCP wait) */
+	boot_timing_phase_begin("network");
 	ret = network_init();
 	if (ret < 0) {
 		LOG_ERR("Failed to initialize network: %d", ret);
 		return ret;
 	}
+	boot_timing_phase_end();
 
 	LOG_INF("Network initialized successfully");
 
 	/* Initialize HTTP API server */
+	boot_timing_phase_begin("http");
 	ret = http_api_init();
 	if (ret < 0) {
 		LOG_ERR("Failed to initialize HTTP API: %d", ret);
 		return ret;
 	}
+	boot_timing_phase_end();
 
 	LOG_INF("HTTP API initialized successfully");
 
+	/* Start UDP binary control listener */
+	boot_timing_phase_begin("udp");
+	ret = udp_control_init();
+	if (ret < 0) {
+		LOG_ERR("Failed to initialize UDP control: %d", ret);
+		return ret;
+	}
+	boot_timing_phase_end();
+
+	LOG_INF("UDP control initialized successfully");
+
+	/* Start multicast state beacon */
+	boot_timing_phase_begin("beacon");
+	ret = state_beacon_init();
+	if (ret < 0) {
+		LOG_ERR("Failed to initialize state beacon: %d", ret);
+		return ret;
+	}
+	boot_timing_phase_end();
+
+	LOG_INF("State beacon initialized successfully");
+
 	/* Display network status */
 	struct network_status net_status;
 	ret = network_get_status(&net_status);
@@ -81,16 +107,19 @@ int main(void)
 
 #if defined(CONFIG_SHELL)
 	/* Initialize shell commands */
+	boot_timing_phase_begin("shell");
 	ret = shell_cmds_init();
 	if (ret < 0) {
 		LOG_ERR("Failed to initialize shell commands: %d", ret);
 		return ret;
 	}
+	boot_timing_phase_end();
 
 	LOG_INF("Shell commands initialized");
 #endif
 
-	LOG_INF("JTAG Switch ready - Default: Connector 0 selected");
+	boot_timing_mark_ready();
+	LOG_INF("JTAG Switch ready (boot took %lld ms)", boot_timing_ready_ms());
 #if defined(CONFIG_SHELL)
 	LOG_INF("Type 'jtag help' or 'net help' for available commands");
 #endif
@@ -8,17 +8,21 @@
 #include <zephyr/kernel.h>
 #include <zephyr/net/http/server.h>
 #include <zephyr/net/http/service.h>
+#include <zephyr/net/dns_sd.h>
+#include <zephyr/net/hostname.h>
 #include <zephyr/logging/log.h>
 
 #include "http_api.h"
 #include "http_rest_api.h"
 #include "http_web_ui.h"
+#include "http_ws.h"
+#include "http_sse.h"
 
 LOG_MODULE_REGISTER(http_api, LOG_LEVEL_INF);
 
 /* Resource registration - must be defined before HTTP_SERVICE_DEFINE */
 
-/* Root path serves gzipped index.html using STATIC resource */
+/* Root path serves gzipped index.html (ETag-validated, 304 on match) */
 HTTP_RESOURCE_DEFINE(index_resource, jtag_switch_service, "/", &index_resource_detail);
 /* Alternate path for direct access */
 HTTP_RESOURCE_DEFINE(index_alt_resource, jtag_switch_service, "/index.html", &index_resource_detail);
@@ -36,13 +40,101 @@ HTTP_RESOURCE_DEFINE(select_resource, jtag_switch_service, "/api/select",
 		     &select_resource_detail);
 HTTP_RESOURCE_DEFINE(toggle_resource, jtag_switch_service, "/api/toggle",
 		     &toggle_resource_detail);
+HTTP_RESOURCE_DEFINE(batch_resource, jtag_switch_service, "/api/batch",
+		     &batch_resource_detail);
+HTTP_RESOURCE_DEFINE(metrics_resource, jtag_switch_service, "/api/metrics",
+		     &metrics_resource_detail);
+HTTP_RESOURCE_DEFINE(events_resource, jtag_switch_service, "/api/events",
+		     &events_resource_detail);
+HTTP_RESOURCE_DEFINE(config_resource, jtag_switch_service, "/api/config",
+		     &config_resource_detail);
 HTTP_RESOURCE_DEFINE(network_config_resource, jtag_switch_service, "/api/network/config",
 		     &network_config_resource_detail);
 
-/* HTTP service definition - must be after resource definitions */
-static uint16_t http_port = 80;
+/* WebSocket state-push endpoint */
+HTTP_RESOURCE_DEFINE(ws_resource, jtag_switch_service, "/api/ws",
+		     &ws_resource_detail);
+
+/* Server-sent events status stream for the web UI */
+HTTP_RESOURCE_DEFINE(sse_resource, jtag_switch_service, "/api/status/stream",
+		     &sse_resource_detail);
+
+/*
+ * Dedicated automation service: the REST resources exposed again on
+ * their own port with their own client slots. A human opening the
+ * dashboard (asset fetches plus status polling) fills slots on the
+ * port-80 service only, so a control POST arriving here never queues
+ * behind UI traffic. The resource details are shared; handlers key
+ * their per-client state off the client context, not the service.
+ */
+HTTP_RESOURCE_DEFINE(api_health_resource, jtag_api_service, "/api/health",
+		     &health_resource_detail);
+HTTP_RESOURCE_DEFINE(api_status_resource, jtag_api_service, "/api/status",
+		     &status_resource_detail);
+HTTP_RESOURCE_DEFINE(api_info_resource, jtag_api_service, "/api/info",
+		     &info_resource_detail);
+HTTP_RESOURCE_DEFINE(api_select_resource, jtag_api_service, "/api/select",
+		     &select_resource_detail);
+HTTP_RESOURCE_DEFINE(api_toggle_resource, jtag_api_service, "/api/toggle",
+		     &toggle_resource_detail);
+HTTP_RESOURCE_DEFINE(api_batch_resource, jtag_api_service, "/api/batch",
+		     &batch_resource_detail);
+HTTP_RESOURCE_DEFINE(api_metrics_resource, jtag_api_service, "/api/metrics",
+		     &metrics_resource_detail);
+HTTP_RESOURCE_DEFINE(api_events_resource, jtag_api_service, "/api/events",
+		     &events_resource_detail);
+HTTP_RESOURCE_DEFINE(api_config_resource, jtag_api_service, "/api/config",
+		     &config_resource_detail);
+HTTP_RESOURCE_DEFINE(api_network_config_resource, jtag_api_service,
+		     "/api/network/config", &network_config_resource_detail);
+HTTP_RESOURCE_DEFINE(api_ws_resource, jtag_api_service, "/api/ws",
+		     &ws_resource_detail);
+
+/* HTTP service definitions - must be after resource definitions */
+#define HTTP_API_PORT 80
+#define HTTP_API_CONTROL_PORT 8080
+
+/*
+ * Client slot split: the global CONFIG_HTTP_SERVER_MAX_CLIENTS pool is
+ * partitioned per service, so the automation slots cannot be consumed
+ * by the dashboard and vice versa.
+ */
+#define WEB_SERVICE_CONCURRENT 4
+#define API_SERVICE_CONCURRENT 2
+BUILD_ASSERT(WEB_SERVICE_CONCURRENT + API_SERVICE_CONCURRENT <=
+	     CONFIG_HTTP_SERVER_MAX_CLIENTS,
+	     "Per-service client slots exceed the global client pool");
+
+static uint16_t http_port = HTTP_API_PORT;
+static uint16_t http_control_port = HTTP_API_CONTROL_PORT;
+
 HTTP_SERVICE_DEFINE(jtag_switch_service, NULL, &http_port,
-		    CONFIG_HTTP_SERVER_MAX_CLIENTS, 10, NULL, NULL, NULL);
+		    WEB_SERVICE_CONCURRENT, 10, NULL, NULL, NULL);
+HTTP_SERVICE_DEFINE(jtag_api_service, NULL, &http_control_port,
+		    API_SERVICE_CONCURRENT, 10, NULL, NULL, NULL);
+
+#ifdef CONFIG_MDNS_RESPONDER
+/*
+ * DNS-SD advertisement: a service browse for _jtag-switch._tcp discovers
+ * every unit on the subnet in one shot, instead of probing GET /api/info
+ * address by address. The instance name must be unique per unit or a
+ * rack of switches collapses into one browse result, so it is filled
+ * from the runtime hostname (which carries the MAC suffix under
+ * CONFIG_NET_HOSTNAME_UNIQUE) at init; the Kconfig literal is only the
+ * fallback until then.
+ */
+static char dns_sd_instance[DNS_SD_INSTANCE_MAX_SIZE + 1] = CONFIG_NET_HOSTNAME;
+
+DNS_SD_REGISTER_TCP_SERVICE(jtag_switch_sd, dns_sd_instance,
+			    "_jtag-switch", "local", DNS_SD_EMPTY_TXT,
+			    HTTP_API_PORT);
+/* The automation port is advertised separately so controllers need no
+ * hard-coded port list
+ */
+DNS_SD_REGISTER_TCP_SERVICE(jtag_api_sd, dns_sd_instance,
+			    "_jtag-switch-api", "local", DNS_SD_EMPTY_TXT,
+			    HTTP_API_CONTROL_PORT);
+#endif
 
 int http_api_init(void)
 {
@@ -50,6 +142,36 @@ int http_api_init(void)
 
 	LOG_INF("Initializing HTTP API server...");
 
+#ifdef CONFIG_MDNS_RESPONDER
+	/* The unique hostname suffix is applied when the interface comes
+	 * up, which network_init() has already done by this point
+	 */
+	strncpy(dns_sd_instance, net_hostname_get(),
+		sizeof(dns_sd_instance) - 1);
+	LOG_INF("DNS-SD instance: %s", dns_sd_instance);
+#endif
+
+	/* Pre-encode cached responses before accepting connections */
+	ret = http_rest_api_init();
+	if (ret < 0) {
+		LOG_ERR("Failed to initialize REST API: %d", ret);
+		return ret;
+	}
+
+	/* Initialize WebSocket state-push before accepting connections */
+	ret = http_ws_init();
+	if (ret < 0) {
+		LOG_ERR("Failed to initialize WebSocket push: %d", ret);
+		return ret;
+	}
+
+	/* Initialize the SSE status stream for the web UI */
+	ret = http_sse_init();
+	if (ret < 0) {
+		LOG_ERR("Failed to initialize SSE stream: %d", ret);
+		return ret;
+	}
+
 	/* Start the HTTP server */
 	ret = http_server_start();
 	if (ret < 0) {
@@ -58,6 +180,8 @@ int http_api_init(void)
 	}
 
 	LOG_INF("HTTP API server started on port %d", http_port);
+	LOG_INF("Automation API service on port %d (dedicated client slots)",
+		http_control_port);
 	LOG_INF("Web UI available at http://192.168.1.x/");
 	LOG_INF("API endpoints:");
 	LOG_INF("  GET  /api/health        - Health check");
@@ -65,7 +189,13 @@ int http_api_init(void)
 	LOG_INF("  GET  /api/info          - Get device information");
 	LOG_INF("  POST /api/select        - Set select line");
 	LOG_INF("  POST /api/toggle        - Toggle select line");
+	LOG_INF("  POST /api/batch         - Atomic operation sequence");
+	LOG_INF("  GET  /api/metrics       - Prometheus metrics");
+	LOG_INF("  GET  /api/events        - Switch event log");
+	LOG_INF("  POST /api/config        - Runtime config (fast mode, log level)");
 	LOG_INF("  POST /api/network/config - Configure network");
+	LOG_INF("  WS   /api/ws            - State-push WebSocket");
+	LOG_INF("  SSE  /api/status/stream - State-push event stream");
 
 	return 0;
 }
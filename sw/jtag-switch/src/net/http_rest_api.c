@@ -9,13 +9,17 @@
 #include <zephyr/net/http/server.h>
 #include <zephyr/net/http/service.h>
 #include <zephyr/net/socket.h>
+#include <zephyr/net/net_pkt.h>
 #include <zephyr/data/json.h>
 #include <zephyr/logging/log.h>
 #include <string.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
 #include <zephyr/sys/sys_heap.h>
 
 #include "http_rest_api.h"
+#include "../boot_timing.h"
 #include "../gpio/gpio_control.h"
 #include "network_config.h"
 
@@ -24,19 +28,127 @@ LOG_MODULE_REGISTER(http_rest_api, LOG_LEVEL_INF);
 /* Kernel heap for runtime statistics */
 extern struct k_heap _system_heap;
 
-/* Buffer for building JSON responses */
+/* Buffer sizes for JSON requests and responses */
 #define JSON_BUFFER_SIZE 512
-static char json_response_buffer[JSON_BUFFER_SIZE];
+#define REQUEST_BUFFER_SIZE 512
+
+/*
+ * Immediate switch requests are handed to the gpio_control actuation
+ * thread so the pin writes do not run in the HTTP server thread; the
+ * handler blocks for the result up to this bound before giving up with
+ * a 500 rather than stalling the connection.
+ */
+#define REST_ACTUATION_TIMEOUT K_MSEC(500)
+
+/* ========== Per-Client Buffer Pool ========== */
+
+/*
+ * Each HTTP connection gets its own request accumulator and response
+ * buffer, keyed by the http_client_ctx pointer. The server allocates
+ * client contexts from a static array of CONFIG_HTTP_SERVER_MAX_CLIENTS
+ * entries, so a pool of the same size can never run out: a recycled
+ * context pointer simply maps back to the same slot.
+ *
+ * This replaces the single shared response buffer and the static
+ * request accumulators that let two concurrent clients corrupt each
+ * other's requests and responses.
+ */
+struct client_buf {
+	struct http_client_ctx *client;  /* Owning connection, NULL = free */
+	uint8_t request[REQUEST_BUFFER_SIZE];
+	size_t request_offset;
+	char response[JSON_BUFFER_SIZE];
+};
+
+static struct client_buf client_bufs[CONFIG_HTTP_SERVER_MAX_CLIENTS];
+static K_MUTEX_DEFINE(client_bufs_mutex);
+
+/**
+ * @brief Get the buffer slot for a connection, claiming a free one if new
+ * @return Buffer slot, or NULL if the pool is exhausted
+ */
+static struct client_buf *client_buf_get(struct http_client_ctx *client)
+{
+	struct client_buf *free_slot = NULL;
+
+	k_mutex_lock(&client_bufs_mutex, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(client_bufs); i++) {
+		if (client_bufs[i].client == client) {
+			k_mutex_unlock(&client_bufs_mutex);
+			return &client_bufs[i];
+		}
+		if (client_bufs[i].client == NULL && free_slot == NULL) {
+			free_slot = &client_bufs[i];
+		}
+	}
+
+	if (free_slot != NULL) {
+		free_slot->client = client;
+		free_slot->request_offset = 0;
+	}
+
+	k_mutex_unlock(&client_bufs_mutex);
+
+	return free_slot;
+}
+
+/* ========== Endpoint Request/Error Counters ========== */
+
+enum rest_endpoint {
+	REST_ENDPOINT_HEALTH,
+	REST_ENDPOINT_STATUS,
+	REST_ENDPOINT_INFO,
+	REST_ENDPOINT_SELECT,
+	REST_ENDPOINT_TOGGLE,
+	REST_ENDPOINT_BATCH,
+	REST_ENDPOINT_NETWORK_CONFIG,
+	REST_ENDPOINT_METRICS,
+	REST_ENDPOINT_EVENTS,
+	REST_ENDPOINT_CONFIG,
+	REST_ENDPOINT_COUNT,
+};
+
+static const char *const rest_endpoint_names[REST_ENDPOINT_COUNT] = {
+	[REST_ENDPOINT_HEALTH] = "health",
+	[REST_ENDPOINT_STATUS] = "status",
+	[REST_ENDPOINT_INFO] = "info",
+	[REST_ENDPOINT_SELECT] = "select",
+	[REST_ENDPOINT_TOGGLE] = "toggle",
+	[REST_ENDPOINT_BATCH] = "batch",
+	[REST_ENDPOINT_NETWORK_CONFIG] = "network_config",
+	[REST_ENDPOINT_METRICS] = "metrics",
+	[REST_ENDPOINT_EVENTS] = "events",
+	[REST_ENDPOINT_CONFIG] = "config",
+};
+
+static atomic_t rest_request_counts[REST_ENDPOINT_COUNT];
+static atomic_t rest_error_counts[REST_ENDPOINT_COUNT];
+
+/* One atomic increment per completed request on the hot path */
+static inline void rest_count_request(enum rest_endpoint ep)
+{
+	atomic_inc(&rest_request_counts[ep]);
+}
+
+static inline void rest_count_error(enum rest_endpoint ep)
+{
+	atomic_inc(&rest_error_counts[ep]);
+}
 
 /* JSON parsing structures */
 struct select_request {
 	int line;
 	int connector;
+	int delay_ms;    /* Optional: fire after this many ms */
+	int64_t at_ms;   /* Optional: fire at this absolute uptime (ms) */
 };
 
 static const struct json_obj_descr select_request_descr[] = {
 	JSON_OBJ_DESCR_PRIM(struct select_request, line, JSON_TOK_NUMBER),
 	JSON_OBJ_DESCR_PRIM(struct select_request, connector, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct select_request, delay_ms, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct select_request, at_ms, JSON_TOK_INT64),
 };
 
 struct toggle_request {
@@ -47,6 +159,32 @@ static const struct json_obj_descr toggle_request_descr[] = {
 	JSON_OBJ_DESCR_PRIM(struct toggle_request, line, JSON_TOK_NUMBER),
 };
 
+/* Batch request - POST /api/batch */
+#define BATCH_MAX_OPS 8
+
+struct batch_op_request {
+	const char *op;
+	int line;
+	int state;
+};
+
+static const struct json_obj_descr batch_op_request_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct batch_op_request, op, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct batch_op_request, line, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct batch_op_request, state, JSON_TOK_NUMBER),
+};
+
+struct batch_request {
+	struct batch_op_request ops[BATCH_MAX_OPS];
+	size_t num_ops;
+};
+
+static const struct json_obj_descr batch_request_descr[] = {
+	JSON_OBJ_DESCR_OBJ_ARRAY(struct batch_request, ops, BATCH_MAX_OPS,
+				 num_ops, batch_op_request_descr,
+				 ARRAY_SIZE(batch_op_request_descr)),
+};
+
 /* ========== JSON Response Structures ========== */
 
 /* Common error response */
@@ -59,11 +197,41 @@ static const struct json_obj_descr error_response_descr[] = {
 };
 
 /* Device info - GET /api/info */
+/**
+ * @brief One init-phase duration in the boot timing table
+ */
+struct info_boot_phase {
+	const char *name;
+	uint32_t start_ms;
+	uint32_t ms;
+};
+
+struct info_boot_data {
+	uint32_t ready_ms;  /* Uptime at "JTAG Switch ready", 0 while booting */
+	struct info_boot_phase phases[BOOT_TIMING_MAX_PHASES];
+	size_t num_phases;
+};
+
 struct info_response {
 	char *device;
 	char version[16];
 	char zephyr[16];
 	char *board;
+	struct info_boot_data boot;
+};
+
+static const struct json_obj_descr info_boot_phase_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct info_boot_phase, name, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct info_boot_phase, start_ms, JSON_TOK_INT),
+	JSON_OBJ_DESCR_PRIM(struct info_boot_phase, ms, JSON_TOK_INT)
+};
+
+static const struct json_obj_descr info_boot_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct info_boot_data, ready_ms, JSON_TOK_INT),
+	JSON_OBJ_DESCR_OBJ_ARRAY(struct info_boot_data, phases,
+				 BOOT_TIMING_MAX_PHASES, num_phases,
+				 info_boot_phase_descr,
+				 ARRAY_SIZE(info_boot_phase_descr))
 };
 
 static const struct json_obj_descr info_response_descr[] = {
@@ -71,6 +239,7 @@ static const struct json_obj_descr info_response_descr[] = {
 	JSON_OBJ_DESCR_PRIM(struct info_response, version, JSON_TOK_STRING_BUF),
 	JSON_OBJ_DESCR_PRIM(struct info_response, zephyr, JSON_TOK_STRING_BUF),
 	JSON_OBJ_DESCR_PRIM(struct info_response, board, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_OBJECT(struct info_response, boot, info_boot_descr),
 };
 
 /* GPIO select - POST /api/select */
@@ -78,12 +247,14 @@ struct select_response {
 	bool success;
 	bool select0;
 	bool select1;
+	bool scheduled;
 };
 
 static const struct json_obj_descr select_response_descr[] = {
 	JSON_OBJ_DESCR_PRIM(struct select_response, success, JSON_TOK_TRUE),
 	JSON_OBJ_DESCR_PRIM(struct select_response, select0, JSON_TOK_TRUE),
 	JSON_OBJ_DESCR_PRIM(struct select_response, select1, JSON_TOK_TRUE),
+	JSON_OBJ_DESCR_PRIM(struct select_response, scheduled, JSON_TOK_TRUE),
 };
 
 /* GPIO toggle - POST /api/toggle */
@@ -115,7 +286,20 @@ static int health_handler(struct http_client_ctx *client, enum http_data_status
 			  const struct http_request_ctx *request_ctx,
 			  struct http_response_ctx *response_ctx, void *user_data)
 {
+	struct client_buf *cbuf = client_buf_get(client);
+
+	if (cbuf == NULL) {
+		/* Cannot happen while pool size == CONFIG_HTTP_SERVER_MAX_CLIENTS */
+		if (status == HTTP_SERVER_DATA_FINAL) {
+			response_ctx->status = HTTP_503_SERVICE_UNAVAILABLE;
+			response_ctx->final_chunk = true;
+		}
+		return 0;
+	}
+
 	if (status == HTTP_SERVER_DATA_FINAL) {
+		rest_count_request(REST_ENDPOINT_HEALTH);
+
 		struct status_response {
 			char *status;
 		};
@@ -126,10 +310,10 @@ static int health_handler(struct http_client_ctx *client, enum http_data_status
 
 		const int ret = json_obj_encode_buf(status_response_descr, ARRAY_SIZE(status_response_descr),
 					  "ok",
-					  json_response_buffer, sizeof(json_response_buffer));
+					  cbuf->response, sizeof(cbuf->response));
 		if (ret == 0) {
-			response_ctx->body = (const uint8_t *)json_response_buffer;
-			response_ctx->body_len = strlen(json_response_buffer);
+			response_ctx->body = (const uint8_t *)cbuf->response;
+			response_ctx->body_len = strlen(cbuf->response);
 			response_ctx->final_chunk = true;
 			response_ctx->status = HTTP_200_OK;
 		}
@@ -148,88 +332,284 @@ struct http_resource_detail_dynamic health_resource_detail = {
 };
 
 /* Status endpoint - GET /api/status */
-static int status_handler(struct http_client_ctx *client, enum http_data_status status,
-			  const struct http_request_ctx *request_ctx,
-			  struct http_response_ctx *response_ctx, void *user_data)
+
+/*
+ * Status response buffer: larger than the shared JSON size because the
+ * system section carries a stack watermark entry per thread.
+ */
+#define STATUS_BUFFER_SIZE 1536
+
+/* Stack watermark reporting: slots for every thread the firmware runs */
+#define STATUS_MAX_STACKS 16
+#define STATUS_STACK_NAME_LEN 16
+
+/*
+ * Cached /api/status response. Rebuilt only when a select line or the
+ * network configuration changes (dirty flag) or the reported uptime
+ * second advances; the polling hot path otherwise serves the cached
+ * encoding directly.
+ */
+static char status_cache[STATUS_BUFFER_SIZE];
+static size_t status_cache_len;
+static uint32_t status_cache_uptime;
+static bool status_cache_valid;
+
+void http_rest_api_status_invalidate(void)
 {
+	status_cache_valid = false;
+}
 
-	int ret = 0;
+/**
+ * @brief One thread's stack high-water mark
+ */
+struct status_stack_data {
+	char name[STATUS_STACK_NAME_LEN];
+	uint32_t size;  /* Configured stack size in bytes */
+	uint32_t peak;  /* Deepest observed usage since boot */
+};
 
-	struct system_data {
-		uint32_t uptime;
-		uint32_t heap_used;
-	};
+/**
+ * @brief Network packet/buffer pool usage
+ *
+ * Packet slabs report the boot-to-now peak; the data buffer pools only
+ * expose an instantaneous count, so "used" there is at sample time.
+ */
+struct status_net_buf_data {
+	uint32_t rx_pkt_peak;
+	uint32_t rx_pkt_total;
+	uint32_t tx_pkt_peak;
+	uint32_t tx_pkt_total;
+	uint32_t rx_data_used;
+	uint32_t rx_data_total;
+	uint32_t tx_data_used;
+	uint32_t tx_data_total;
+};
 
+struct status_system_data {
+	uint32_t uptime;
+	uint32_t heap_used;
+	uint32_t heap_max;
+	struct status_net_buf_data net_bufs;
+	struct status_stack_data stacks[STATUS_MAX_STACKS];
+	size_t num_stacks;
+};
 
-	struct system_status_response_str{
-		bool select0;
-		bool select1;
-		struct network_status network;
-		struct system_data system;
-	} system_status_response;
-
-	const struct json_obj_descr network_descr[] = {
-		JSON_OBJ_DESCR_PRIM(struct network_status, ip, JSON_TOK_STRING_BUF),
-		JSON_OBJ_DESCR_PRIM(struct network_status, netmask, JSON_TOK_STRING_BUF),
-		JSON_OBJ_DESCR_PRIM(struct network_status, gateway, JSON_TOK_STRING_BUF),
-		JSON_OBJ_DESCR_PRIM(struct network_status, mac, JSON_TOK_STRING_BUF),
-		JSON_OBJ_DESCR_PRIM(struct network_status, link_up, JSON_TOK_TRUE),
-		JSON_OBJ_DESCR_PRIM(struct network_status, dhcp_enabled, JSON_TOK_TRUE)
-	};
+struct system_status_response_str {
+	bool select0;
+	bool select1;
+	struct network_status network;
+	struct status_system_data system;
+};
 
-	const struct json_obj_descr system_descr[] = {
-		JSON_OBJ_DESCR_PRIM(struct system_data, uptime, JSON_TOK_INT),
-		JSON_OBJ_DESCR_PRIM(struct system_data, heap_used, JSON_TOK_INT)
-	};
+static const struct json_obj_descr status_network_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct network_status, ip, JSON_TOK_STRING_BUF),
+	JSON_OBJ_DESCR_PRIM(struct network_status, netmask, JSON_TOK_STRING_BUF),
+	JSON_OBJ_DESCR_PRIM(struct network_status, gateway, JSON_TOK_STRING_BUF),
+	JSON_OBJ_DESCR_PRIM(struct network_status, mac, JSON_TOK_STRING_BUF),
+	JSON_OBJ_DESCR_PRIM(struct network_status, link_up, JSON_TOK_TRUE),
+	JSON_OBJ_DESCR_PRIM(struct network_status, dhcp_enabled, JSON_TOK_TRUE)
+};
 
-	const struct json_obj_descr system_status_response_descr[] = {
-		JSON_OBJ_DESCR_PRIM(struct system_status_response_str, select0, JSON_TOK_TRUE),
-		JSON_OBJ_DESCR_PRIM(struct system_status_response_str, select1, JSON_TOK_TRUE),
-		JSON_OBJ_DESCR_OBJECT(struct system_status_response_str, network, network_descr),
-		JSON_OBJ_DESCR_OBJECT(struct system_status_response_str, system, system_descr)
-	};
+static const struct json_obj_descr status_stack_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct status_stack_data, name, JSON_TOK_STRING_BUF),
+	JSON_OBJ_DESCR_PRIM(struct status_stack_data, size, JSON_TOK_INT),
+	JSON_OBJ_DESCR_PRIM(struct status_stack_data, peak, JSON_TOK_INT)
+};
 
-	if (status == HTTP_SERVER_DATA_FINAL) {
-		/* Get GPIO status */
-		ret = gpio_control_get_select(0, &system_status_response.select0);
-		if (ret < 0) {
-			system_status_response.select0 = false;
-		}
+static const struct json_obj_descr status_net_buf_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct status_net_buf_data, rx_pkt_peak, JSON_TOK_INT),
+	JSON_OBJ_DESCR_PRIM(struct status_net_buf_data, rx_pkt_total, JSON_TOK_INT),
+	JSON_OBJ_DESCR_PRIM(struct status_net_buf_data, tx_pkt_peak, JSON_TOK_INT),
+	JSON_OBJ_DESCR_PRIM(struct status_net_buf_data, tx_pkt_total, JSON_TOK_INT),
+	JSON_OBJ_DESCR_PRIM(struct status_net_buf_data, rx_data_used, JSON_TOK_INT),
+	JSON_OBJ_DESCR_PRIM(struct status_net_buf_data, rx_data_total, JSON_TOK_INT),
+	JSON_OBJ_DESCR_PRIM(struct status_net_buf_data, tx_data_used, JSON_TOK_INT),
+	JSON_OBJ_DESCR_PRIM(struct status_net_buf_data, tx_data_total, JSON_TOK_INT)
+};
 
-		ret = gpio_control_get_select(1, &system_status_response.select1);
-		if (ret < 0) {
-			system_status_response.select1 = false;
-		}
+static const struct json_obj_descr status_system_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct status_system_data, uptime, JSON_TOK_INT),
+	JSON_OBJ_DESCR_PRIM(struct status_system_data, heap_used, JSON_TOK_INT),
+	JSON_OBJ_DESCR_PRIM(struct status_system_data, heap_max, JSON_TOK_INT),
+	JSON_OBJ_DESCR_OBJECT(struct status_system_data, net_bufs,
+			      status_net_buf_descr),
+	JSON_OBJ_DESCR_OBJ_ARRAY(struct status_system_data, stacks,
+				 STATUS_MAX_STACKS, num_stacks,
+				 status_stack_descr,
+				 ARRAY_SIZE(status_stack_descr))
+};
 
-		/* Get network status */
-		ret = network_get_status(&system_status_response.network);
-		if (ret < 0) {
-			memset(&system_status_response.network, 0, sizeof(system_status_response.network));
-			strcpy(system_status_response.network.ip, "unknown");
-		}
+static const struct json_obj_descr system_status_response_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct system_status_response_str, select0, JSON_TOK_TRUE),
+	JSON_OBJ_DESCR_PRIM(struct system_status_response_str, select1, JSON_TOK_TRUE),
+	JSON_OBJ_DESCR_OBJECT(struct system_status_response_str, network, status_network_descr),
+	JSON_OBJ_DESCR_OBJECT(struct system_status_response_str, system, status_system_descr)
+};
 
-		/* Get system uptime */
-		const int64_t uptime_ms = k_uptime_get();
-		system_status_response.system.uptime = (uint32_t)(uptime_ms / 1000);
+#if defined(CONFIG_THREAD_MONITOR) && defined(CONFIG_INIT_STACKS)
+/**
+ * @brief k_thread_foreach() callback collecting one stack watermark
+ *
+ * Peak usage is stack size minus the untouched region reported by
+ * k_thread_stack_space_get(); a pool sized well has a visible margin
+ * between peak and size after a long soak.
+ */
+static void stack_report_cb(const struct k_thread *thread, void *user_data)
+{
+	struct status_system_data *sys = user_data;
+	struct status_stack_data *slot;
+	const char *name;
+	size_t unused;
 
-		/* Get heap statistics */
-		struct sys_memory_stats heap_stats = {0};
+	if (sys->num_stacks >= STATUS_MAX_STACKS) {
+		return;
+	}
 
-		if (sys_heap_runtime_stats_get(&_system_heap.heap, &heap_stats) == 0) {
-			system_status_response.system.heap_used = (uint32_t)heap_stats.allocated_bytes;
-		}else {
-			system_status_response.system.heap_used = 0;
-		}
+	if (k_thread_stack_space_get(thread, &unused) < 0) {
+		return;
+	}
 
-		ret = json_obj_encode_buf(system_status_response_descr, ARRAY_SIZE(system_status_response_descr),
-							  &system_status_response,
-							  json_response_buffer, sizeof(json_response_buffer));
-		if (ret == 0) {
-			response_ctx->body = (const uint8_t *)json_response_buffer;
-			response_ctx->body_len = strlen(json_response_buffer);
-			response_ctx->final_chunk = true;
-			response_ctx->status = HTTP_200_OK;
+	slot = &sys->stacks[sys->num_stacks];
+
+	name = k_thread_name_get((k_tid_t)thread);
+	if (name == NULL || name[0] == '\0') {
+		snprintf(slot->name, sizeof(slot->name), "%p", (void *)thread);
+	} else {
+		strncpy(slot->name, name, sizeof(slot->name) - 1);
+		slot->name[sizeof(slot->name) - 1] = '\0';
+	}
+
+	slot->size = (uint32_t)thread->stack_info.size;
+	slot->peak = (uint32_t)(thread->stack_info.size - unused);
+	sys->num_stacks++;
+}
+#endif /* CONFIG_THREAD_MONITOR && CONFIG_INIT_STACKS */
+
+/**
+ * @brief Fill the net_buf pool usage section
+ */
+static void collect_net_buf_stats(struct status_net_buf_data *nb)
+{
+#ifdef CONFIG_NET_BUF_POOL_USAGE
+	struct k_mem_slab *rx_pkts;
+	struct k_mem_slab *tx_pkts;
+	struct net_buf_pool *rx_data;
+	struct net_buf_pool *tx_data;
+	uint32_t max_used;
+
+	net_pkt_get_info(&rx_pkts, &tx_pkts, &rx_data, &tx_data);
+
+	nb->rx_pkt_total = rx_pkts->info.num_blocks;
+	nb->tx_pkt_total = tx_pkts->info.num_blocks;
+	if (k_mem_slab_max_used_get(rx_pkts, &max_used) == 0) {
+		nb->rx_pkt_peak = max_used;
+	}
+	if (k_mem_slab_max_used_get(tx_pkts, &max_used) == 0) {
+		nb->tx_pkt_peak = max_used;
+	}
+
+	nb->rx_data_total = rx_data->buf_count;
+	nb->rx_data_used = rx_data->buf_count -
+			   (uint32_t)atomic_get(&rx_data->avail_count);
+	nb->tx_data_total = tx_data->buf_count;
+	nb->tx_data_used = tx_data->buf_count -
+			   (uint32_t)atomic_get(&tx_data->avail_count);
+#else
+	ARG_UNUSED(nb);
+#endif /* CONFIG_NET_BUF_POOL_USAGE */
+}
+
+/**
+ * @brief Rebuild the cached /api/status encoding
+ * @return 0 on success, negative errno on failure
+ */
+static int rebuild_status_cache(uint32_t uptime_s)
+{
+	struct system_status_response_str system_status_response;
+	struct sys_memory_stats heap_stats = {0};
+	int ret;
+
+	/* Unsupported telemetry fields read as zero / an empty array */
+	memset(&system_status_response.system, 0,
+	       sizeof(system_status_response.system));
+
+	/* Get GPIO status */
+	ret = gpio_control_get_select(0, &system_status_response.select0);
+	if (ret < 0) {
+		system_status_response.select0 = false;
+	}
+
+	ret = gpio_control_get_select(1, &system_status_response.select1);
+	if (ret < 0) {
+		system_status_response.select1 = false;
+	}
+
+	/* Get network status */
+	ret = network_get_status(&system_status_response.network);
+	if (ret < 0) {
+		memset(&system_status_response.network, 0, sizeof(system_status_response.network));
+		strcpy(system_status_response.network.ip, "unknown");
+	}
+
+	system_status_response.system.uptime = uptime_s;
+
+	/* Get heap statistics: current allocation plus the boot-to-now peak */
+	if (sys_heap_runtime_stats_get(&_system_heap.heap, &heap_stats) == 0) {
+		system_status_response.system.heap_used = (uint32_t)heap_stats.allocated_bytes;
+		system_status_response.system.heap_max =
+			(uint32_t)heap_stats.max_allocated_bytes;
+	}else {
+		system_status_response.system.heap_used = 0;
+	}
+
+	collect_net_buf_stats(&system_status_response.system.net_bufs);
+
+#if defined(CONFIG_THREAD_MONITOR) && defined(CONFIG_INIT_STACKS)
+	/*
+	 * Walk every thread for its stack high-water mark. This briefly
+	 * locks the scheduler, but runs at most once per reported uptime
+	 * second thanks to the response cache.
+	 */
+	k_thread_foreach(stack_report_cb, &system_status_response.system);
+#endif
+
+	ret = json_obj_encode_buf(system_status_response_descr, ARRAY_SIZE(system_status_response_descr),
+						  &system_status_response,
+						  status_cache, sizeof(status_cache));
+	if (ret < 0) {
+		return ret;
+	}
+
+	status_cache_len = strlen(status_cache);
+	status_cache_uptime = uptime_s;
+	status_cache_valid = true;
+
+	return 0;
+}
+
+static int status_handler(struct http_client_ctx *client, enum http_data_status status,
+			  const struct http_request_ctx *request_ctx,
+			  struct http_response_ctx *response_ctx, void *user_data)
+{
+	int ret = 0;
+
+	if (status == HTTP_SERVER_DATA_FINAL) {
+		const uint32_t uptime_s = (uint32_t)(k_uptime_get() / 1000);
+
+		rest_count_request(REST_ENDPOINT_STATUS);
+
+		if (!status_cache_valid || status_cache_uptime != uptime_s) {
+			ret = rebuild_status_cache(uptime_s);
+			if (ret < 0) {
+				rest_count_error(REST_ENDPOINT_STATUS);
+				return ret;
+			}
 		}
+
+		response_ctx->body = (const uint8_t *)status_cache;
+		response_ctx->body_len = status_cache_len;
+		response_ctx->final_chunk = true;
+		response_ctx->status = HTTP_200_OK;
 	}
 	return ret;
 }
@@ -245,39 +625,88 @@ struct http_resource_detail_dynamic status_resource_detail = {
 };
 
 /* Info endpoint - GET /api/info */
+
+/* Room for the version strings plus one boot table row per phase */
+#define INFO_BUFFER_SIZE 768
+
+/*
+ * The info payload (device name, firmware version, Zephyr version, board,
+ * boot timing) cannot change after boot completes. It is pre-encoded from
+ * http_rest_api_init() - which runs mid-boot, before the later init
+ * phases have been timed - and re-encoded on the first request that
+ * finds boot complete, after which the encoding is final.
+ */
+static char info_cache[INFO_BUFFER_SIZE];
+static size_t info_cache_len;
+static bool info_cache_final;
+
+/**
+ * @brief Encode the /api/info response
+ * @return 0 on success, negative errno on failure
+ */
+static int build_info_cache(void)
+{
+	struct info_response info = {
+		.device = "JTAG Switch",
+		.board = CONFIG_BOARD
+	};
+	const struct boot_phase *phases;
+	int num_phases;
+
+	strcpy(info.version, "1.0.0");
+
+	const uint32_t version = sys_kernel_version_get();
+	const uint32_t major = SYS_KERNEL_VER_MAJOR(version);
+	const uint32_t minor = SYS_KERNEL_VER_MINOR(version);
+	const uint32_t patch = SYS_KERNEL_VER_PATCHLEVEL(version);
+	snprintf(info.zephyr, sizeof(info.zephyr), "%u.%u.%u", major, minor, patch);
+
+	info.boot.ready_ms = (uint32_t)boot_timing_ready_ms();
+	num_phases = boot_timing_get_phases(&phases);
+	info.boot.num_phases = MIN(num_phases, BOOT_TIMING_MAX_PHASES);
+	for (size_t i = 0; i < info.boot.num_phases; i++) {
+		info.boot.phases[i].name = phases[i].name;
+		info.boot.phases[i].start_ms = phases[i].start_ms;
+		info.boot.phases[i].ms = phases[i].duration_ms;
+	}
+
+	const int ret = json_obj_encode_buf(info_response_descr,
+					   ARRAY_SIZE(info_response_descr),
+					   &info,
+					   info_cache,
+					   sizeof(info_cache));
+	if (ret < 0) {
+		LOG_ERR("Failed to encode info response: %d", ret);
+		return ret;
+	}
+
+	info_cache_len = strlen(info_cache);
+	info_cache_final = (info.boot.ready_ms > 0);
+	return 0;
+}
+
 static int info_handler(struct http_client_ctx *client, enum http_data_status status,
 			const struct http_request_ctx *request_ctx,
 			struct http_response_ctx *response_ctx, void *user_data)
 {
 	if (status == HTTP_SERVER_DATA_FINAL) {
-		struct info_response info = {
-			.device = "JTAG Switch",
-			.board = CONFIG_BOARD
-		};
-
-		strcpy(info.version, "1.0.0");
+		rest_count_request(REST_ENDPOINT_INFO);
 
-		const uint32_t version = sys_kernel_version_get();
-		const uint32_t major = SYS_KERNEL_VER_MAJOR(version);
-		const uint32_t minor = SYS_KERNEL_VER_MINOR(version);
-		const uint32_t patch = SYS_KERNEL_VER_PATCHLEVEL(version);
-		snprintf(info.zephyr, sizeof(info.zephyr), "%u.%u.%u", major, minor, patch);
-
-		const int ret = json_obj_encode_buf(info_response_descr,
-						   ARRAY_SIZE(info_response_descr),
-						   &info,
-						   json_response_buffer,
-						   sizeof(json_response_buffer));
+		if (!info_cache_final) {
+			/* Picks up the full boot table once boot completes */
+			(void)build_info_cache();
+		}
 
-		if (ret == 0) {
-			response_ctx->body = (const uint8_t *)json_response_buffer;
-			response_ctx->body_len = strlen(json_response_buffer);
-			response_ctx->final_chunk = true;
-			response_ctx->status = HTTP_200_OK;
-		} else {
-			LOG_ERR("Failed to encode info response: %d", ret);
+		if (info_cache_len == 0) {
+			rest_count_error(REST_ENDPOINT_INFO);
 			response_ctx->status = HTTP_500_INTERNAL_SERVER_ERROR;
+			return 0;
 		}
+
+		response_ctx->body = (const uint8_t *)info_cache;
+		response_ctx->body_len = info_cache_len;
+		response_ctx->final_chunk = true;
+		response_ctx->status = HTTP_200_OK;
 	}
 	return 0;
 }
@@ -297,82 +726,118 @@ static int select_handler(struct http_client_ctx *client, enum http_data_status
 			  const struct http_request_ctx *request_ctx,
 			  struct http_response_ctx *response_ctx, void *user_data)
 {
-	static uint8_t request_buffer[128];
-	static size_t request_offset = 0;
-	struct select_request req = {-1,-1};
+	struct select_request req = {-1, -1, -1, -1};
+	struct client_buf *cbuf = client_buf_get(client);
+
+	if (cbuf == NULL) {
+		/* Cannot happen while pool size == CONFIG_HTTP_SERVER_MAX_CLIENTS */
+		if (status == HTTP_SERVER_DATA_FINAL) {
+			response_ctx->status = HTTP_503_SERVICE_UNAVAILABLE;
+			response_ctx->final_chunk = true;
+		}
+		return 0;
+	}
 
 	if (status == HTTP_SERVER_DATA_ABORTED) {
-		request_offset = 0;
+		cbuf->request_offset = 0;
 	}else {
 		/* Accumulate request data */
 		if (request_ctx->data_len > 0) {
 			const size_t to_copy = MIN(request_ctx->data_len,
-						 sizeof(request_buffer) - request_offset);
-			memcpy(request_buffer + request_offset, request_ctx->data, to_copy);
-			request_offset += to_copy;
+						 sizeof(cbuf->request) - cbuf->request_offset);
+			memcpy(cbuf->request + cbuf->request_offset, request_ctx->data, to_copy);
+			cbuf->request_offset += to_copy;
 		}
 	}
 
 	/* Process when final data arrives */
 	if (status == HTTP_SERVER_DATA_FINAL) {
+		rest_count_request(REST_ENDPOINT_SELECT);
+
 		/* Parse JSON */
-		const int64_t parse_ret = json_obj_parse((char *) request_buffer, request_offset,
+		const int64_t parse_ret = json_obj_parse((char *) cbuf->request, cbuf->request_offset,
 		                         select_request_descr,
 		                         ARRAY_SIZE(select_request_descr),
 		                         &req);
 
-		if (parse_ret < 0 || req.line < 0 || req.line > 1 ||
+		if (parse_ret < 0 || req.line < 0 ||
+		    req.line >= gpio_control_num_select_lines() ||
 		    req.connector < 0 || req.connector > 3) {
 			struct error_response err = { .error = "Invalid request parameters" };
 			const int ret = json_obj_encode_buf(error_response_descr,
 							   ARRAY_SIZE(error_response_descr),
-							   &err, json_response_buffer,
-							   sizeof(json_response_buffer));
+							   &err, cbuf->response,
+							   sizeof(cbuf->response));
 			if (ret < 0) {
 				LOG_ERR("Failed to encode error: %d", ret);
-				strcpy(json_response_buffer, "{\"error\":\"Internal error\"}");
+				strcpy(cbuf->response, "{\"error\":\"Internal error\"}");
 			}
 			response_ctx->status = HTTP_400_BAD_REQUEST;
 		} else {
-			/* Set the GPIO line */
+			/* Set the GPIO line, now or at the requested deadline */
 			const bool value = (req.connector == 1 || req.connector == 3);
-			const int ret = gpio_control_set_select(req.line, value);
+			const bool deferred = (req.at_ms >= 0 || req.delay_ms >= 0);
+			int ret;
+
+			gpio_control_set_event_source(GPIO_CONTROL_SRC_REST);
+			if (req.at_ms >= 0) {
+				ret = gpio_control_schedule_select(req.line, value,
+								   req.at_ms);
+			} else if (req.delay_ms >= 0) {
+				ret = gpio_control_schedule_select(req.line, value,
+								   k_uptime_get() +
+								   req.delay_ms);
+			} else {
+				ret = gpio_control_submit_select(req.line, value,
+								 REST_ACTUATION_TIMEOUT);
+			}
 
 			if (ret < 0) {
 				struct error_response err = { .error = "Failed to set GPIO" };
 				const int encode_ret = json_obj_encode_buf(error_response_descr,
 								       ARRAY_SIZE(error_response_descr),
-								       &err, json_response_buffer,
-								       sizeof(json_response_buffer));
+								       &err, cbuf->response,
+								       sizeof(cbuf->response));
 				if (encode_ret < 0) {
 					LOG_ERR("Failed to encode error: %d", encode_ret);
-					strcpy(json_response_buffer, "{\"error\":\"Internal error\"}");
+					strcpy(cbuf->response, "{\"error\":\"Internal error\"}");
 				}
 				response_ctx->status = HTTP_500_INTERNAL_SERVER_ERROR;
 			} else {
-				/* Read both GPIO states to return complete status */
-				struct select_response resp = { .success = true };
+				/*
+				 * Read both GPIO states to return complete status.
+				 * For a deferred request these are the states at
+				 * accept time; the change lands at the deadline.
+				 */
+				struct select_response resp = {
+					.success = true,
+					.scheduled = deferred,
+				};
 				gpio_control_get_select(0, &resp.select0);
 				gpio_control_get_select(1, &resp.select1);
 
 				const int encode_ret = json_obj_encode_buf(select_response_descr,
 								       ARRAY_SIZE(select_response_descr),
-								       &resp, json_response_buffer,
-								       sizeof(json_response_buffer));
+								       &resp, cbuf->response,
+								       sizeof(cbuf->response));
 				if (encode_ret == 0) {
 					response_ctx->status = HTTP_200_OK;
 				} else {
 					LOG_ERR("Failed to encode select response: %d", encode_ret);
-					strcpy(json_response_buffer, "{\"error\":\"Encoding failed\"}");
+					strcpy(cbuf->response, "{\"error\":\"Encoding failed\"}");
 					response_ctx->status = HTTP_500_INTERNAL_SERVER_ERROR;
 				}
 			}
 		}
 
-		response_ctx->body = (const uint8_t *)json_response_buffer;
-		response_ctx->body_len = strlen(json_response_buffer);
+		if (response_ctx->status != HTTP_200_OK) {
+			rest_count_error(REST_ENDPOINT_SELECT);
+		}
+
+		response_ctx->body = (const uint8_t *)cbuf->response;
+		response_ctx->body_len = strlen(cbuf->response);
 		response_ctx->final_chunk = true;
-		request_offset = 0;
+		cbuf->request_offset = 0;
 	}
 
 	return 0;
@@ -393,54 +858,67 @@ static int toggle_handler(struct http_client_ctx *client, enum http_data_status
 			  const struct http_request_ctx *request_ctx,
 			  struct http_response_ctx *response_ctx, void *user_data)
 {
-	static uint8_t request_buffer[128];
-	static size_t request_offset = 0;
 	struct toggle_request req = {-1};
+	struct client_buf *cbuf = client_buf_get(client);
+
+	if (cbuf == NULL) {
+		/* Cannot happen while pool size == CONFIG_HTTP_SERVER_MAX_CLIENTS */
+		if (status == HTTP_SERVER_DATA_FINAL) {
+			response_ctx->status = HTTP_503_SERVICE_UNAVAILABLE;
+			response_ctx->final_chunk = true;
+		}
+		return 0;
+	}
 
 	if (status == HTTP_SERVER_DATA_ABORTED) {
-		request_offset = 0;
+		cbuf->request_offset = 0;
 	}else {
 		/* Accumulate request data */
 		if (request_ctx->data_len > 0) {
 			const size_t to_copy = MIN(request_ctx->data_len,
-						 sizeof(request_buffer) - request_offset);
-			memcpy(request_buffer + request_offset, request_ctx->data, to_copy);
-			request_offset += to_copy;
+						 sizeof(cbuf->request) - cbuf->request_offset);
+			memcpy(cbuf->request + cbuf->request_offset, request_ctx->data, to_copy);
+			cbuf->request_offset += to_copy;
 		}
 	}
 
 	/* Process when final data arrives */
 	if (status == HTTP_SERVER_DATA_FINAL) {
+		rest_count_request(REST_ENDPOINT_TOGGLE);
+
 		/* Parse JSON */
-		const int64_t parse_ret = json_obj_parse((char *)request_buffer, request_offset,
+		const int64_t parse_ret = json_obj_parse((char *)cbuf->request, cbuf->request_offset,
 				    toggle_request_descr,
 				    ARRAY_SIZE(toggle_request_descr),
 				    &req);
 
-		if (parse_ret < 0 || req.line < 0 || req.line > 1) {
+		if (parse_ret < 0 || req.line < 0 ||
+		    req.line >= gpio_control_num_select_lines()) {
 			struct error_response err = { .error = "Invalid line parameter" };
 			const int ret = json_obj_encode_buf(error_response_descr,
 							   ARRAY_SIZE(error_response_descr),
-							   &err, json_response_buffer,
-							   sizeof(json_response_buffer));
+							   &err, cbuf->response,
+							   sizeof(cbuf->response));
 			if (ret < 0) {
 				LOG_ERR("Failed to encode error: %d", ret);
-				strcpy(json_response_buffer, "{\"error\":\"Internal error\"}");
+				strcpy(cbuf->response, "{\"error\":\"Internal error\"}");
 			}
 			response_ctx->status = HTTP_400_BAD_REQUEST;
 		} else {
 			/* Toggle the GPIO line */
-			const int ret = gpio_control_toggle_select(req.line);
+			gpio_control_set_event_source(GPIO_CONTROL_SRC_REST);
+			const int ret = gpio_control_submit_toggle(req.line,
+						REST_ACTUATION_TIMEOUT);
 
 			if (ret < 0) {
 				struct error_response err = { .error = "Failed to toggle GPIO" };
 				const int encode_ret = json_obj_encode_buf(error_response_descr,
 								       ARRAY_SIZE(error_response_descr),
-								       &err, json_response_buffer,
-								       sizeof(json_response_buffer));
+								       &err, cbuf->response,
+								       sizeof(cbuf->response));
 				if (encode_ret < 0) {
 					LOG_ERR("Failed to encode error: %d", encode_ret);
-					strcpy(json_response_buffer, "{\"error\":\"Internal error\"}");
+					strcpy(cbuf->response, "{\"error\":\"Internal error\"}");
 				}
 				response_ctx->status = HTTP_500_INTERNAL_SERVER_ERROR;
 			} else {
@@ -452,22 +930,26 @@ static int toggle_handler(struct http_client_ctx *client, enum http_data_status
 
 				const int encode_ret = json_obj_encode_buf(toggle_response_descr,
 								       ARRAY_SIZE(toggle_response_descr),
-								       &resp, json_response_buffer,
-								       sizeof(json_response_buffer));
+								       &resp, cbuf->response,
+								       sizeof(cbuf->response));
 				if (encode_ret == 0) {
 					response_ctx->status = HTTP_200_OK;
 				} else {
 					LOG_ERR("Failed to encode toggle response: %d", encode_ret);
-					strcpy(json_response_buffer, "{\"error\":\"Encoding failed\"}");
+					strcpy(cbuf->response, "{\"error\":\"Encoding failed\"}");
 					response_ctx->status = HTTP_500_INTERNAL_SERVER_ERROR;
 				}
 			}
 		}
 
-		response_ctx->body = (const uint8_t *)json_response_buffer;
-		response_ctx->body_len = strlen(json_response_buffer);
+		if (response_ctx->status != HTTP_200_OK) {
+			rest_count_error(REST_ENDPOINT_TOGGLE);
+		}
+
+		response_ctx->body = (const uint8_t *)cbuf->response;
+		response_ctx->body_len = strlen(cbuf->response);
 		response_ctx->final_chunk = true;
-		request_offset = 0;
+		cbuf->request_offset = 0;
 	}
 
 	return 0;
@@ -483,154 +965,796 @@ struct http_resource_detail_dynamic toggle_resource_detail = {
 	.user_data = NULL,
 };
 
-/* Network configuration endpoint - POST /api/network/config */
-static int network_config_handler(struct http_client_ctx *client, enum http_data_status status,
-				   const struct http_request_ctx *request_ctx,
-				   struct http_response_ctx *response_ctx, void *user_data)
+/* Batch control endpoint - POST /api/batch */
+static int batch_handler(struct http_client_ctx *client, enum http_data_status status,
+			 const struct http_request_ctx *request_ctx,
+			 struct http_response_ctx *response_ctx, void *user_data)
 {
-	static uint8_t request_buffer[256];
-	static size_t request_offset = 0;
+	struct batch_request req = { .num_ops = 0 };
+	struct gpio_control_batch_op ops[BATCH_MAX_OPS];
+	struct client_buf *cbuf = client_buf_get(client);
+
+	if (cbuf == NULL) {
+		/* Cannot happen while pool size == CONFIG_HTTP_SERVER_MAX_CLIENTS */
+		if (status == HTTP_SERVER_DATA_FINAL) {
+			response_ctx->status = HTTP_503_SERVICE_UNAVAILABLE;
+			response_ctx->final_chunk = true;
+		}
+		return 0;
+	}
 
 	if (status == HTTP_SERVER_DATA_ABORTED) {
-		request_offset = 0;
+		cbuf->request_offset = 0;
+	}else {
+		/* Accumulate request data */
+		if (request_ctx->data_len > 0) {
+			const size_t to_copy = MIN(request_ctx->data_len,
+						 sizeof(cbuf->request) - cbuf->request_offset);
+			memcpy(cbuf->request + cbuf->request_offset, request_ctx->data, to_copy);
+			cbuf->request_offset += to_copy;
+		}
+	}
+
+	/* Process when final data arrives */
+	if (status == HTTP_SERVER_DATA_FINAL) {
+		bool valid = true;
+
+		rest_count_request(REST_ENDPOINT_BATCH);
+
+		/* Parse JSON */
+		const int64_t parse_ret = json_obj_parse((char *)cbuf->request, cbuf->request_offset,
+					 batch_request_descr,
+					 ARRAY_SIZE(batch_request_descr),
+					 &req);
+
+		if (parse_ret < 0 || req.num_ops == 0) {
+			valid = false;
+		}
+
+		/* Translate and validate each operation */
+		for (size_t i = 0; valid && i < req.num_ops; i++) {
+			const struct batch_op_request *op_req = &req.ops[i];
+
+			if (op_req->line < 0 ||
+			    op_req->line >= gpio_control_num_select_lines()) {
+				valid = false;
+				break;
+			}
+
+			ops[i].select_line = (uint8_t)op_req->line;
+
+			if (op_req->op != NULL && strcmp(op_req->op, "set") == 0) {
+				if (op_req->state < 0 || op_req->state > 1) {
+					valid = false;
+					break;
+				}
+				ops[i].op = GPIO_CONTROL_OP_SET;
+				ops[i].state = (op_req->state == 1);
+			} else if (op_req->op != NULL && strcmp(op_req->op, "toggle") == 0) {
+				ops[i].op = GPIO_CONTROL_OP_TOGGLE;
+				ops[i].state = false;
+			} else {
+				valid = false;
+				break;
+			}
+		}
+
+		if (!valid) {
+			struct error_response err = { .error = "Invalid batch request" };
+			const int ret = json_obj_encode_buf(error_response_descr,
+							   ARRAY_SIZE(error_response_descr),
+							   &err, cbuf->response,
+							   sizeof(cbuf->response));
+			if (ret < 0) {
+				LOG_ERR("Failed to encode error: %d", ret);
+				strcpy(cbuf->response, "{\"error\":\"Internal error\"}");
+			}
+			response_ctx->status = HTTP_400_BAD_REQUEST;
+		} else {
+			/* Execute the whole sequence atomically */
+			gpio_control_set_event_source(GPIO_CONTROL_SRC_REST);
+			const int ret = gpio_control_batch(ops, req.num_ops);
+
+			if (ret < 0) {
+				struct error_response err = { .error = "Batch execution failed" };
+				const int encode_ret = json_obj_encode_buf(error_response_descr,
+								       ARRAY_SIZE(error_response_descr),
+								       &err, cbuf->response,
+								       sizeof(cbuf->response));
+				if (encode_ret < 0) {
+					LOG_ERR("Failed to encode error: %d", encode_ret);
+					strcpy(cbuf->response, "{\"error\":\"Internal error\"}");
+				}
+				response_ctx->status = HTTP_500_INTERNAL_SERVER_ERROR;
+			} else {
+				/* Read both GPIO states to return complete status */
+				struct select_response resp = { .success = true };
+				gpio_control_get_select(0, &resp.select0);
+				gpio_control_get_select(1, &resp.select1);
+
+				const int encode_ret = json_obj_encode_buf(select_response_descr,
+								       ARRAY_SIZE(select_response_descr),
+								       &resp, cbuf->response,
+								       sizeof(cbuf->response));
+				if (encode_ret == 0) {
+					response_ctx->status = HTTP_200_OK;
+				} else {
+					LOG_ERR("Failed to encode batch response: %d", encode_ret);
+					strcpy(cbuf->response, "{\"error\":\"Encoding failed\"}");
+					response_ctx->status = HTTP_500_INTERNAL_SERVER_ERROR;
+				}
+			}
+		}
+
+		if (response_ctx->status != HTTP_200_OK) {
+			rest_count_error(REST_ENDPOINT_BATCH);
+		}
+
+		response_ctx->body = (const uint8_t *)cbuf->response;
+		response_ctx->body_len = strlen(cbuf->response);
+		response_ctx->final_chunk = true;
+		cbuf->request_offset = 0;
+	}
+
+	return 0;
+}
+
+struct http_resource_detail_dynamic batch_resource_detail = {
+	.common = {
+		.type = HTTP_RESOURCE_TYPE_DYNAMIC,
+		.bitmask_of_supported_http_methods = BIT(HTTP_POST),
+		.content_type = "application/json",
+	},
+	.cb = batch_handler,
+	.user_data = NULL,
+};
+
+/* ========== Chunked Response Writer ========== */
+
+/*
+ * Incremental writer for large responses. Instead of encoding a whole
+ * payload into a big static buffer and measuring it with strlen, a
+ * handler emits printf-style fragments into a small window; when the
+ * window fills, the handler returns the window as one chunk with
+ * final_chunk=false and the server re-invokes it to continue. Responses
+ * of any size stream through CHUNK_WINDOW_SIZE bytes of RAM.
+ *
+ * The window and the per-endpoint stream states are safely shared
+ * statics: the HTTP service thread runs exactly one dynamic response to
+ * completion before starting another.
+ */
+#define CHUNK_WINDOW_SIZE 512
+
+static char chunk_window[CHUNK_WINDOW_SIZE];
+
+struct chunk_writer {
+	size_t len;   /* Bytes written into chunk_window */
+	bool full;    /* A fragment did not fit; emit and resume next call */
+};
+
+/**
+ * @brief Append one printf-style fragment to the window
+ *
+ * Fragments are atomic: when one does not fit the remaining window, the
+ * write is rolled back and the writer is marked full, so the producer
+ * can re-emit the same fragment into the next chunk.
+ *
+ * @return true if the fragment was written, false if the window is full
+ */
+static bool chunk_writer_printf(struct chunk_writer *cw, const char *fmt, ...)
+{
+	va_list args;
+	int len;
+
+	if (cw->full) {
+		return false;
+	}
+
+	va_start(args, fmt);
+	len = vsnprintk(chunk_window + cw->len,
+			sizeof(chunk_window) - cw->len, fmt, args);
+	va_end(args);
+
+	if (len < 0 || (size_t)len >= sizeof(chunk_window) - cw->len) {
+		chunk_window[cw->len] = '\0';  /* Roll back the partial write */
+		cw->full = true;
+		return false;
+	}
+
+	cw->len += len;
+	return true;
+}
+
+/* Metrics endpoint - GET /api/metrics */
+
+/* Exposition progress, advanced one fragment at a time across chunks */
+static struct {
+	bool in_progress;
+	int section;
+	int index;
+	uint32_t cumulative;
+	bool have_latency;
+	struct gpio_control_latency_stats latency;
+} metrics_stream;
+
+enum metrics_section {
+	METRICS_SEC_REQ_HEADER,
+	METRICS_SEC_REQUESTS,
+	METRICS_SEC_ERR_HEADER,
+	METRICS_SEC_ERRORS,
+	METRICS_SEC_SWITCH,
+	METRICS_SEC_BUCKETS,
+	METRICS_SEC_BUCKET_TAIL,
+	METRICS_SEC_VERIFY,
+	METRICS_SEC_UPTIME,
+	METRICS_SEC_HEAP,
+	METRICS_SEC_DONE,
+};
+
+/**
+ * @brief Emit as much of the metrics exposition as fits one window
+ *
+ * Resumable: picks up at the fragment where the previous chunk filled
+ * up. Returns true when the exposition is complete.
+ */
+static bool metrics_emit(struct chunk_writer *cw)
+{
+	while (!cw->full) {
+		switch (metrics_stream.section) {
+		case METRICS_SEC_REQ_HEADER:
+			if (!chunk_writer_printf(cw,
+				"# TYPE jtag_http_requests_total counter\n")) {
+				break;
+			}
+			metrics_stream.section = METRICS_SEC_REQUESTS;
+			metrics_stream.index = 0;
+			break;
+		case METRICS_SEC_REQUESTS:
+			if (metrics_stream.index >= REST_ENDPOINT_COUNT) {
+				metrics_stream.section = METRICS_SEC_ERR_HEADER;
+				break;
+			}
+			if (!chunk_writer_printf(cw,
+				"jtag_http_requests_total{endpoint=\"%s\"} %ld\n",
+				rest_endpoint_names[metrics_stream.index],
+				atomic_get(&rest_request_counts[metrics_stream.index]))) {
+				break;
+			}
+			metrics_stream.index++;
+			break;
+		case METRICS_SEC_ERR_HEADER:
+			if (!chunk_writer_printf(cw,
+				"# TYPE jtag_http_request_errors_total counter\n")) {
+				break;
+			}
+			metrics_stream.section = METRICS_SEC_ERRORS;
+			metrics_stream.index = 0;
+			break;
+		case METRICS_SEC_ERRORS:
+			if (metrics_stream.index >= REST_ENDPOINT_COUNT) {
+				metrics_stream.section = METRICS_SEC_SWITCH;
+				break;
+			}
+			if (!chunk_writer_printf(cw,
+				"jtag_http_request_errors_total{endpoint=\"%s\"} %ld\n",
+				rest_endpoint_names[metrics_stream.index],
+				atomic_get(&rest_error_counts[metrics_stream.index]))) {
+				break;
+			}
+			metrics_stream.index++;
+			break;
+		case METRICS_SEC_SWITCH:
+			if (!metrics_stream.have_latency) {
+				metrics_stream.section = METRICS_SEC_VERIFY;
+				break;
+			}
+			if (!chunk_writer_printf(cw,
+				"# TYPE jtag_switch_operations_total counter\n"
+				"jtag_switch_operations_total %u\n"
+				"# TYPE jtag_switch_latency_cycles histogram\n",
+				metrics_stream.latency.count)) {
+				break;
+			}
+			metrics_stream.section = METRICS_SEC_BUCKETS;
+			metrics_stream.index = 0;
+			metrics_stream.cumulative = 0;
+			break;
+		case METRICS_SEC_BUCKETS:
+			if (metrics_stream.index >= GPIO_CONTROL_LATENCY_BUCKETS) {
+				metrics_stream.section = METRICS_SEC_BUCKET_TAIL;
+				break;
+			}
+			if (!chunk_writer_printf(cw,
+				"jtag_switch_latency_cycles_bucket{le=\"%u\"} %u\n",
+				1U << (metrics_stream.index + 1),
+				metrics_stream.cumulative +
+				metrics_stream.latency.buckets[metrics_stream.index])) {
+				break;
+			}
+			metrics_stream.cumulative +=
+				metrics_stream.latency.buckets[metrics_stream.index];
+			metrics_stream.index++;
+			break;
+		case METRICS_SEC_BUCKET_TAIL:
+			if (!chunk_writer_printf(cw,
+				"jtag_switch_latency_cycles_bucket{le=\"+Inf\"} %u\n"
+				"jtag_switch_latency_cycles_count %u\n",
+				metrics_stream.latency.count,
+				metrics_stream.latency.count)) {
+				break;
+			}
+			metrics_stream.section = METRICS_SEC_VERIFY;
+			break;
+		case METRICS_SEC_VERIFY:
+			if (!chunk_writer_printf(cw,
+				"# TYPE jtag_verify_mismatches_total counter\n"
+				"jtag_verify_mismatches_total %u\n",
+				gpio_control_get_verify_mismatches())) {
+				break;
+			}
+			metrics_stream.section = METRICS_SEC_UPTIME;
+			break;
+		case METRICS_SEC_UPTIME:
+			if (!chunk_writer_printf(cw,
+				"# TYPE jtag_uptime_seconds gauge\n"
+				"jtag_uptime_seconds %lld\n",
+				k_uptime_get() / 1000)) {
+				break;
+			}
+			metrics_stream.section = METRICS_SEC_HEAP;
+			break;
+		case METRICS_SEC_HEAP: {
+			struct sys_memory_stats heap_stats = {0};
+
+			if (sys_heap_runtime_stats_get(&_system_heap.heap,
+						       &heap_stats) == 0) {
+				if (!chunk_writer_printf(cw,
+					"# TYPE jtag_heap_used_bytes gauge\n"
+					"jtag_heap_used_bytes %zu\n",
+					heap_stats.allocated_bytes)) {
+					break;
+				}
+			}
+			metrics_stream.section = METRICS_SEC_DONE;
+			break;
+		}
+		case METRICS_SEC_DONE:
+			return true;
+		}
+	}
+
+	return metrics_stream.section == METRICS_SEC_DONE;
+}
+
+static int metrics_handler(struct http_client_ctx *client, enum http_data_status status,
+			   const struct http_request_ctx *request_ctx,
+			   struct http_response_ctx *response_ctx, void *user_data)
+{
+	struct chunk_writer cw = {0};
+	bool done;
+
+	if (status == HTTP_SERVER_DATA_ABORTED) {
+		metrics_stream.in_progress = false;
+		return 0;
+	}
+
+	if (status != HTTP_SERVER_DATA_FINAL) {
+		return 0;
+	}
+
+	if (!metrics_stream.in_progress) {
+		rest_count_request(REST_ENDPOINT_METRICS);
+
+		/* Snapshot once so the histogram is consistent across chunks */
+		memset(&metrics_stream, 0, sizeof(metrics_stream));
+		metrics_stream.have_latency =
+			(gpio_control_get_latency_stats(&metrics_stream.latency) == 0);
+		metrics_stream.in_progress = true;
+	}
+
+	done = metrics_emit(&cw);
+	if (done) {
+		metrics_stream.in_progress = false;
+	}
+
+	response_ctx->body = (const uint8_t *)chunk_window;
+	response_ctx->body_len = cw.len;
+	response_ctx->final_chunk = done;
+	response_ctx->status = HTTP_200_OK;
+
+	return 0;
+}
+
+struct http_resource_detail_dynamic metrics_resource_detail = {
+	.common = {
+		.type = HTTP_RESOURCE_TYPE_DYNAMIC,
+		.bitmask_of_supported_http_methods = BIT(HTTP_GET),
+		.content_type = "text/plain; version=0.0.4",
+	},
+	.cb = metrics_handler,
+	.user_data = NULL,
+};
+
+/* Event log endpoint - GET /api/events */
+
+/* Snapshot of the ring, held across chunks of one streamed response */
+static struct gpio_control_event events_snapshot[GPIO_CONTROL_EVENT_RING_SIZE];
+
+/* Listing progress across chunks */
+static struct {
+	bool in_progress;
+	int pos;    /* Next snapshot index to emit */
+	int count;
+} events_stream;
+
+static const char *const event_source_names[] = {
+	[GPIO_CONTROL_SRC_INTERNAL] = "internal",
+	[GPIO_CONTROL_SRC_SHELL] = "shell",
+	[GPIO_CONTROL_SRC_REST] = "rest",
+	[GPIO_CONTROL_SRC_UDP] = "udp",
+};
+
+static int events_handler(struct http_client_ctx *client, enum http_data_status status,
+			  const struct http_request_ctx *request_ctx,
+			  struct http_response_ctx *response_ctx, void *user_data)
+{
+	struct chunk_writer cw = {0};
+	bool done = false;
+
+	if (status == HTTP_SERVER_DATA_ABORTED) {
+		events_stream.in_progress = false;
+		return 0;
+	}
+
+	if (status != HTTP_SERVER_DATA_FINAL) {
+		return 0;
+	}
+
+	if (!events_stream.in_progress) {
+		uint32_t since = 0;
+		uint32_t next = 0;
+		const char *query;
+
+		rest_count_request(REST_ENDPOINT_EVENTS);
+
+		/* Optional ?since=<seq> cursor in the request URL */
+		query = strchr(client->url_buf, '?');
+		if (query != NULL) {
+			const char *cursor = strstr(query, "since=");
+
+			if (cursor != NULL) {
+				since = (uint32_t)strtoul(cursor + strlen("since="),
+							  NULL, 10);
+			}
+		}
+
+		events_stream.count = gpio_control_get_events(since, events_snapshot,
+							      ARRAY_SIZE(events_snapshot),
+							      &next);
+		if (events_stream.count < 0) {
+			events_stream.count = 0;
+		}
+		events_stream.pos = 0;
+		events_stream.in_progress = true;
+
+		/* The object header always fits an empty window */
+		chunk_writer_printf(&cw, "{\"next\":%u,\"events\":[", next);
+	}
+
+	while (events_stream.pos < events_stream.count) {
+		const struct gpio_control_event *evt =
+			&events_snapshot[events_stream.pos];
+
+		if (!chunk_writer_printf(&cw,
+			"%s{\"seq\":%u,\"t_ms\":%lld,"
+			"\"old\":%u,\"new\":%u,\"source\":\"%s\"}",
+			(events_stream.pos > 0) ? "," : "",
+			evt->seq, evt->uptime_ms,
+			evt->old_state, evt->new_state,
+			event_source_names[evt->source])) {
+			break;
+		}
+		events_stream.pos++;
+	}
+
+	if (events_stream.pos >= events_stream.count &&
+	    chunk_writer_printf(&cw, "]}")) {
+		done = true;
+		events_stream.in_progress = false;
+	}
+
+	response_ctx->body = (const uint8_t *)chunk_window;
+	response_ctx->body_len = cw.len;
+	response_ctx->final_chunk = done;
+	response_ctx->status = HTTP_200_OK;
+
+	return 0;
+}
+
+struct http_resource_detail_dynamic events_resource_detail = {
+	.common = {
+		.type = HTTP_RESOURCE_TYPE_DYNAMIC,
+		.bitmask_of_supported_http_methods = BIT(HTTP_GET),
+		.content_type = "application/json",
+	},
+	.cb = events_handler,
+	.user_data = NULL,
+};
+
+/* Runtime configuration endpoint - POST /api/config */
+
+/* All fields optional: -1 leaves the setting unchanged */
+struct config_request {
+	int fast_switch;      /* 0/1: fast-switch mode */
+	int log_level;        /* 0-4: gpio_control runtime log level */
+	int deferred_verify;  /* 0/1: defer GPIO readback to the auditor */
+};
+
+static const struct json_obj_descr config_request_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct config_request, fast_switch, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct config_request, log_level, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct config_request, deferred_verify, JSON_TOK_NUMBER),
+};
+
+struct config_response {
+	bool success;
+	bool fast_switch;
+	bool deferred_verify;
+};
+
+static const struct json_obj_descr config_response_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct config_response, success, JSON_TOK_TRUE),
+	JSON_OBJ_DESCR_PRIM(struct config_response, fast_switch, JSON_TOK_TRUE),
+	JSON_OBJ_DESCR_PRIM(struct config_response, deferred_verify, JSON_TOK_TRUE),
+};
+
+static int config_handler(struct http_client_ctx *client, enum http_data_status status,
+			  const struct http_request_ctx *request_ctx,
+			  struct http_response_ctx *response_ctx, void *user_data)
+{
+	struct config_request req = {-1, -1, -1};
+	struct client_buf *cbuf = client_buf_get(client);
+
+	if (cbuf == NULL) {
+		/* Cannot happen while pool size == CONFIG_HTTP_SERVER_MAX_CLIENTS */
+		if (status == HTTP_SERVER_DATA_FINAL) {
+			response_ctx->status = HTTP_503_SERVICE_UNAVAILABLE;
+			response_ctx->final_chunk = true;
+		}
+		return 0;
+	}
+
+	if (status == HTTP_SERVER_DATA_ABORTED) {
+		cbuf->request_offset = 0;
 	} else {
 		/* Accumulate request data */
 		if (request_ctx->data_len > 0) {
 			const size_t to_copy = MIN(request_ctx->data_len,
-						 sizeof(request_buffer) - request_offset);
-			memcpy(request_buffer + request_offset, request_ctx->data, to_copy);
-			request_offset += to_copy;
+						 sizeof(cbuf->request) - cbuf->request_offset);
+			memcpy(cbuf->request + cbuf->request_offset, request_ctx->data, to_copy);
+			cbuf->request_offset += to_copy;
 		}
 	}
 
 	/* Process when final data arrives */
 	if (status == HTTP_SERVER_DATA_FINAL) {
-		/* Null-terminate the JSON string */
-		if (request_offset < sizeof(request_buffer)) {
-			request_buffer[request_offset] = '\0';
+		bool valid;
+
+		rest_count_request(REST_ENDPOINT_CONFIG);
+
+		const int64_t parse_ret = json_obj_parse((char *)cbuf->request,
+					 cbuf->request_offset,
+					 config_request_descr,
+					 ARRAY_SIZE(config_request_descr),
+					 &req);
+
+		valid = (parse_ret >= 0) &&
+			(req.fast_switch >= -1 && req.fast_switch <= 1) &&
+			(req.log_level >= -1 && req.log_level <= 4) &&
+			(req.deferred_verify >= -1 && req.deferred_verify <= 1);
+
+		if (valid && req.log_level >= 0) {
+			const int ret = gpio_control_set_log_level(req.log_level);
+
+			if (ret < 0) {
+				valid = false;
+			}
 		}
 
-		/* Simple parsing - look for "mode":"dhcp" or "mode":"static" */
-		const char *mode_ptr = strstr((char *)request_buffer, "\"mode\"");
-		if (mode_ptr == NULL) {
-			struct error_response err = { .error = "Missing mode parameter" };
+		if (!valid) {
+			struct error_response err = { .error = "Invalid config request" };
 			const int ret = json_obj_encode_buf(error_response_descr,
 							   ARRAY_SIZE(error_response_descr),
-							   &err, json_response_buffer,
-							   sizeof(json_response_buffer));
+							   &err, cbuf->response,
+							   sizeof(cbuf->response));
 			if (ret < 0) {
 				LOG_ERR("Failed to encode error: %d", ret);
-				strcpy(json_response_buffer, "{\"error\":\"Internal error\"}");
+				strcpy(cbuf->response, "{\"error\":\"Internal error\"}");
 			}
 			response_ctx->status = HTTP_400_BAD_REQUEST;
 		} else {
-			int ret;
-			const bool is_dhcp = (strstr(mode_ptr, "dhcp") != NULL);
+			if (req.fast_switch >= 0) {
+				gpio_control_set_fast_mode(req.fast_switch == 1);
+			}
+
+			if (req.deferred_verify >= 0) {
+				gpio_control_set_deferred_verify(req.deferred_verify == 1);
+			}
+
+			struct config_response resp = {
+				.success = true,
+				.fast_switch = gpio_control_get_fast_mode(),
+				.deferred_verify = gpio_control_get_deferred_verify(),
+			};
+			const int encode_ret = json_obj_encode_buf(config_response_descr,
+							       ARRAY_SIZE(config_response_descr),
+							       &resp, cbuf->response,
+							       sizeof(cbuf->response));
+			if (encode_ret == 0) {
+				response_ctx->status = HTTP_200_OK;
+			} else {
+				LOG_ERR("Failed to encode config response: %d", encode_ret);
+				strcpy(cbuf->response, "{\"error\":\"Encoding failed\"}");
+				response_ctx->status = HTTP_500_INTERNAL_SERVER_ERROR;
+			}
+		}
+
+		if (response_ctx->status != HTTP_200_OK) {
+			rest_count_error(REST_ENDPOINT_CONFIG);
+		}
+
+		response_ctx->body = (const uint8_t *)cbuf->response;
+		response_ctx->body_len = strlen(cbuf->response);
+		response_ctx->final_chunk = true;
+		cbuf->request_offset = 0;
+	}
+
+	return 0;
+}
+
+struct http_resource_detail_dynamic config_resource_detail = {
+	.common = {
+		.type = HTTP_RESOURCE_TYPE_DYNAMIC,
+		.bitmask_of_supported_http_methods = BIT(HTTP_POST),
+		.content_type = "application/json",
+	},
+	.cb = config_handler,
+	.user_data = NULL,
+};
+
+/* Network configuration endpoint - POST /api/network/config */
+
+/*
+ * Parsed with a descriptor like every other JSON endpoint: one pass over
+ * the buffer, key order and whitespace per the client's serializer.
+ * json_obj_parse() terminates the strings in place, so the fields point
+ * into the request buffer; unset fields stay NULL.
+ */
+struct network_config_request {
+	const char *mode;
+	const char *ip;
+	const char *netmask;
+	const char *gateway;
+};
+
+static const struct json_obj_descr network_config_request_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct network_config_request, mode, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct network_config_request, ip, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct network_config_request, netmask, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct network_config_request, gateway, JSON_TOK_STRING),
+};
+
+static int network_config_handler(struct http_client_ctx *client, enum http_data_status status,
+				   const struct http_request_ctx *request_ctx,
+				   struct http_response_ctx *response_ctx, void *user_data)
+{
+	struct client_buf *cbuf = client_buf_get(client);
+
+	if (cbuf == NULL) {
+		/* Cannot happen while pool size == CONFIG_HTTP_SERVER_MAX_CLIENTS */
+		if (status == HTTP_SERVER_DATA_FINAL) {
+			response_ctx->status = HTTP_503_SERVICE_UNAVAILABLE;
+			response_ctx->final_chunk = true;
+		}
+		return 0;
+	}
+
+	if (status == HTTP_SERVER_DATA_ABORTED) {
+		cbuf->request_offset = 0;
+	} else {
+		/* Accumulate request data */
+		if (request_ctx->data_len > 0) {
+			const size_t to_copy = MIN(request_ctx->data_len,
+						 sizeof(cbuf->request) - cbuf->request_offset);
+			memcpy(cbuf->request + cbuf->request_offset, request_ctx->data, to_copy);
+			cbuf->request_offset += to_copy;
+		}
+	}
+
+	/* Process when final data arrives */
+	if (status == HTTP_SERVER_DATA_FINAL) {
+		struct network_config_request req = {0};
+		const char *error = NULL;
+		int ret;
 
-			if (is_dhcp) {
-				/* Enable DHCP */
-				ret = network_enable_dhcp();
+		rest_count_request(REST_ENDPOINT_NETWORK_CONFIG);
+
+		/* Parse JSON */
+		const int64_t parse_ret = json_obj_parse((char *)cbuf->request,
+					cbuf->request_offset,
+					network_config_request_descr,
+					ARRAY_SIZE(network_config_request_descr),
+					&req);
+
+		if (parse_ret < 0 || req.mode == NULL) {
+			error = "Missing mode parameter";
+			response_ctx->status = HTTP_400_BAD_REQUEST;
+		} else if (strcmp(req.mode, "dhcp") == 0) {
+			ret = network_enable_dhcp();
+			if (ret < 0) {
+				error = "Failed to enable DHCP";
+				response_ctx->status = HTTP_500_INTERNAL_SERVER_ERROR;
+			}
+		} else if (strcmp(req.mode, "static") == 0) {
+			if (req.ip == NULL || req.netmask == NULL ||
+			    req.gateway == NULL) {
+				error = "Missing IP parameters";
+				response_ctx->status = HTTP_400_BAD_REQUEST;
+			} else {
+				ret = network_set_static_ip(req.ip, req.netmask,
+							    req.gateway);
 				if (ret < 0) {
-					struct error_response err = { .error = "Failed to enable DHCP" };
-					const int encode_ret = json_obj_encode_buf(error_response_descr,
-									       ARRAY_SIZE(error_response_descr),
-									       &err, json_response_buffer,
-									       sizeof(json_response_buffer));
-					if (encode_ret < 0) {
-						LOG_ERR("Failed to encode error: %d", encode_ret);
-						strcpy(json_response_buffer, "{\"error\":\"Internal error\"}");
-					}
+					error = "Failed to set static IP";
 					response_ctx->status = HTTP_500_INTERNAL_SERVER_ERROR;
-				} else {
-					/* Save configuration */
-					network_config_save();
-
-					struct success_restart_response resp = {
-						.success = true,
-						.restart_required = true
-					};
-					const int encode_ret = json_obj_encode_buf(success_restart_response_descr,
-									       ARRAY_SIZE(success_restart_response_descr),
-									       &resp, json_response_buffer,
-									       sizeof(json_response_buffer));
-					if (encode_ret == 0) {
-						response_ctx->status = HTTP_200_OK;
-					} else {
-						LOG_ERR("Failed to encode response: %d", encode_ret);
-						strcpy(json_response_buffer, "{\"error\":\"Encoding failed\"}");
-						response_ctx->status = HTTP_500_INTERNAL_SERVER_ERROR;
-					}
-
-					/* Schedule network restart */
-					network_restart();
 				}
+			}
+		} else {
+			error = "Invalid mode parameter";
+			response_ctx->status = HTTP_400_BAD_REQUEST;
+		}
+
+		if (error != NULL) {
+			struct error_response err = { .error = (char *)error };
+			const int encode_ret = json_obj_encode_buf(error_response_descr,
+							       ARRAY_SIZE(error_response_descr),
+							       &err, cbuf->response,
+							       sizeof(cbuf->response));
+			if (encode_ret < 0) {
+				LOG_ERR("Failed to encode error: %d", encode_ret);
+				strcpy(cbuf->response, "{\"error\":\"Internal error\"}");
+			}
+		} else {
+			/* Save configuration */
+			network_config_save();
+
+			struct success_restart_response resp = {
+				.success = true,
+				.restart_required = true
+			};
+			const int encode_ret = json_obj_encode_buf(success_restart_response_descr,
+							       ARRAY_SIZE(success_restart_response_descr),
+							       &resp, cbuf->response,
+							       sizeof(cbuf->response));
+			if (encode_ret == 0) {
+				response_ctx->status = HTTP_200_OK;
 			} else {
-				/* Parse static IP parameters (simple string search) */
-				char ip[16] = {0}, netmask[16] = {0}, gateway[16] = {0};
-				const char *ip_ptr = strstr((char *)request_buffer, "\"ip\"");
-				const char *nm_ptr = strstr((char *)request_buffer, "\"netmask\"");
-				const char *gw_ptr = strstr((char *)request_buffer, "\"gateway\"");
-
-				if (ip_ptr && nm_ptr && gw_ptr) {
-					/* Extract IP address */
-					sscanf(ip_ptr, "\"ip\":\"%15[0-9.]\"", ip);
-					sscanf(nm_ptr, "\"netmask\":\"%15[0-9.]\"", netmask);
-					sscanf(gw_ptr, "\"gateway\":\"%15[0-9.]\"", gateway);
-
-					ret = network_set_static_ip(ip, netmask, gateway);
-					if (ret < 0) {
-						struct error_response err = { .error = "Failed to set static IP" };
-						const int encode_ret = json_obj_encode_buf(error_response_descr,
-										       ARRAY_SIZE(error_response_descr),
-										       &err, json_response_buffer,
-										       sizeof(json_response_buffer));
-						if (encode_ret < 0) {
-							LOG_ERR("Failed to encode error: %d", encode_ret);
-							strcpy(json_response_buffer, "{\"error\":\"Internal error\"}");
-						}
-						response_ctx->status = HTTP_500_INTERNAL_SERVER_ERROR;
-					} else {
-						/* Save configuration */
-						network_config_save();
-
-						struct success_restart_response resp = {
-							.success = true,
-							.restart_required = true
-						};
-						const int encode_ret = json_obj_encode_buf(success_restart_response_descr,
-										       ARRAY_SIZE(success_restart_response_descr),
-										       &resp, json_response_buffer,
-										       sizeof(json_response_buffer));
-						if (encode_ret == 0) {
-							response_ctx->status = HTTP_200_OK;
-						} else {
-							LOG_ERR("Failed to encode response: %d", encode_ret);
-							strcpy(json_response_buffer, "{\"error\":\"Encoding failed\"}");
-							response_ctx->status = HTTP_500_INTERNAL_SERVER_ERROR;
-						}
-
-						/* Schedule network restart */
-						network_restart();
-					}
-				} else {
-					struct error_response err = { .error = "Missing IP parameters" };
-					const int encode_ret = json_obj_encode_buf(error_response_descr,
-									       ARRAY_SIZE(error_response_descr),
-									       &err, json_response_buffer,
-									       sizeof(json_response_buffer));
-					if (encode_ret < 0) {
-						LOG_ERR("Failed to encode error: %d", encode_ret);
-						strcpy(json_response_buffer, "{\"error\":\"Internal error\"}");
-					}
-					response_ctx->status = HTTP_400_BAD_REQUEST;
-				}
+				LOG_ERR("Failed to encode response: %d", encode_ret);
+				strcpy(cbuf->response, "{\"error\":\"Encoding failed\"}");
+				response_ctx->status = HTTP_500_INTERNAL_SERVER_ERROR;
 			}
+
+			/* Schedule network restart */
+			network_restart();
 		}
 
-		response_ctx->body = (const uint8_t *)json_response_buffer;
-		response_ctx->body_len = strlen(json_response_buffer);
+		if (response_ctx->status != HTTP_200_OK) {
+			rest_count_error(REST_ENDPOINT_NETWORK_CONFIG);
+		}
+
+		response_ctx->body = (const uint8_t *)cbuf->response;
+		response_ctx->body_len = strlen(cbuf->response);
 		response_ctx->final_chunk = true;
-		request_offset = 0;
+		cbuf->request_offset = 0;
 	}
 
 	return 0;
@@ -645,3 +1769,23 @@ struct http_resource_detail_dynamic network_config_resource_detail = {
 	.cb = network_config_handler,
 	.user_data = NULL,
 };
+
+int http_rest_api_init(void)
+{
+	int ret;
+
+	/* Encode the immutable info response once */
+	ret = build_info_cache();
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* Invalidate the status cache whenever a select line changes */
+	ret = gpio_control_register_change_cb(http_rest_api_status_invalidate);
+	if (ret < 0) {
+		LOG_ERR("Failed to register status invalidation callback: %d", ret);
+		return ret;
+	}
+
+	return 0;
+}
@@ -21,6 +21,29 @@ extern struct http_resource_detail_dynamic status_resource_detail;
 extern struct http_resource_detail_dynamic info_resource_detail;
 extern struct http_resource_detail_dynamic select_resource_detail;
 extern struct http_resource_detail_dynamic toggle_resource_detail;
+extern struct http_resource_detail_dynamic batch_resource_detail;
+extern struct http_resource_detail_dynamic metrics_resource_detail;
+extern struct http_resource_detail_dynamic events_resource_detail;
+extern struct http_resource_detail_dynamic config_resource_detail;
 extern struct http_resource_detail_dynamic network_config_resource_detail;
 
+/**
+ * @brief Initialize the REST API handlers
+ *
+ * Pre-encodes the immutable /api/info response and registers the
+ * state-change callback that invalidates the cached /api/status body.
+ * Called from http_api_init() before the server starts.
+ *
+ * @return 0 on success, negative errno on failure
+ */
+int http_rest_api_init(void);
+
+/**
+ * @brief Invalidate the cached /api/status response
+ *
+ * Called when device state that the status endpoint reports has changed,
+ * e.g. from the network management event handler.
+ */
+void http_rest_api_status_invalidate(void);
+
 #endif /* HTTP_REST_API_H */
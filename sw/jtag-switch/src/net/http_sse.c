@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2025 JTAG Switch Project
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Server-Sent Events Status Stream Implementation
+ *
+ * GET /api/status/stream sends the current select-line state as an SSE
+ * event, then holds the connection for up to SSE_HOLD_MS waiting for a
+ * state change before ending the response. The Zephyr HTTP server sends
+ * every chunk of a dynamic response from its single service thread, so
+ * the hold directly delays every other client of that thread — including
+ * the automation service, which shares it. SSE_HOLD_MS is therefore kept
+ * to a few tens of milliseconds: small against REST handler timeouts,
+ * while still catching a change that lands right after the connect. A
+ * change that lands between holds is delivered on the next reconnect,
+ * bounded by SSE_RETRY_MS, which is sized so the steady-state request
+ * rate stays below the 2 s polling this stream replaced.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/http/server.h>
+#include <zephyr/net/http/service.h>
+#include <zephyr/logging/log.h>
+#include <string.h>
+
+#include "http_sse.h"
+#include "../gpio/gpio_control.h"
+
+LOG_MODULE_REGISTER(http_sse, LOG_LEVEL_INF);
+
+/*
+ * How long one response may hold the server waiting for a change. This
+ * blocks the shared service thread, so it must stay well below the REST
+ * actuation timeout even with several dashboard tabs serializing holds.
+ */
+#define SSE_HOLD_MS 20
+
+/*
+ * EventSource reconnect delay pushed to the browser. Sets the idle
+ * reconnect cadence (and the worst-case latency for a change landing
+ * between holds), so one tab costs about one request per second.
+ */
+#define SSE_RETRY_MS 1000
+
+#define SSE_BUFFER_SIZE 128
+
+static char sse_buffer[SSE_BUFFER_SIZE];
+
+/*
+ * One pending-change token. The GPIO change callback gives it; a held
+ * stream takes it. Limit 1 makes bursts collapse into a single wakeup.
+ */
+static K_SEM_DEFINE(sse_change_sem, 0, 1);
+
+/*
+ * Response phase for the connection currently being served. The server
+ * runs one dynamic response to completion before serving anyone else,
+ * so a single phase flag cannot be interleaved between clients.
+ */
+static bool sse_held;
+
+/**
+ * @brief GPIO state-change callback; wakes a held stream
+ */
+static void sse_state_change_cb(void)
+{
+	k_sem_give(&sse_change_sem);
+}
+
+/**
+ * @brief Format the current state as one SSE data event
+ * @return Event length, or negative errno on failure
+ */
+static int sse_format_event(char *buf, size_t buf_len, bool with_retry)
+{
+	bool select0 = false;
+	bool select1 = false;
+	int len;
+
+	gpio_control_get_select(0, &select0);
+	gpio_control_get_select(1, &select1);
+
+	len = snprintk(buf, buf_len,
+		       "%sdata: {\"select0\":%s,\"select1\":%s}\n\n",
+		       with_retry ? "retry: " STRINGIFY(SSE_RETRY_MS) "\n\n" : "",
+		       select0 ? "true" : "false",
+		       select1 ? "true" : "false");
+
+	if (len < 0 || (size_t)len >= buf_len) {
+		return -ENOMEM;
+	}
+
+	return len;
+}
+
+/* SSE stream endpoint - GET /api/status/stream */
+static int sse_handler(struct http_client_ctx *client, enum http_data_status status,
+		       const struct http_request_ctx *request_ctx,
+		       struct http_response_ctx *response_ctx, void *user_data)
+{
+	int len;
+
+	if (status != HTTP_SERVER_DATA_FINAL) {
+		return 0;
+	}
+
+	if (!sse_held) {
+		/* First chunk: retry hint plus the current state */
+		k_sem_reset(&sse_change_sem);
+
+		len = sse_format_event(sse_buffer, sizeof(sse_buffer), true);
+		if (len < 0) {
+			response_ctx->status = HTTP_500_INTERNAL_SERVER_ERROR;
+			response_ctx->final_chunk = true;
+			return 0;
+		}
+
+		sse_held = true;
+		response_ctx->status = HTTP_200_OK;
+		response_ctx->body = (const uint8_t *)sse_buffer;
+		response_ctx->body_len = len;
+		response_ctx->final_chunk = false;
+		return 0;
+	}
+
+	/* Second chunk: hold for a change, then end the response */
+	sse_held = false;
+
+	if (k_sem_take(&sse_change_sem, K_MSEC(SSE_HOLD_MS)) == 0) {
+		len = sse_format_event(sse_buffer, sizeof(sse_buffer), false);
+	} else {
+		/* No change during the hold; comment keeps SSE parsers happy */
+		len = snprintk(sse_buffer, sizeof(sse_buffer), ": idle\n\n");
+	}
+
+	if (len < 0) {
+		len = 0;
+	}
+
+	response_ctx->body = (const uint8_t *)sse_buffer;
+	response_ctx->body_len = len;
+	response_ctx->final_chunk = true;
+	return 0;
+}
+
+struct http_resource_detail_dynamic sse_resource_detail = {
+	.common = {
+		.type = HTTP_RESOURCE_TYPE_DYNAMIC,
+		.bitmask_of_supported_http_methods = BIT(HTTP_GET),
+		.content_type = "text/event-stream",
+	},
+	.cb = sse_handler,
+	.user_data = NULL,
+};
+
+int http_sse_init(void)
+{
+	int ret;
+
+	ret = gpio_control_register_change_cb(sse_state_change_cb);
+	if (ret < 0) {
+		LOG_ERR("Failed to register state-change callback: %d", ret);
+		return ret;
+	}
+
+	LOG_INF("SSE status stream initialized");
+
+	return 0;
+}
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2025 JTAG Switch Project
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Server-Sent Events Status Stream
+ *
+ * Streams select-line state to the web UI over a plain HTTP response,
+ * so an EventSource in the browser replaces periodic /api/status polls.
+ */
+
+#ifndef HTTP_SSE_H
+#define HTTP_SSE_H
+
+#include <zephyr/net/http/service.h>
+
+/**
+ * @brief SSE endpoint resource detail
+ *
+ * Registered with the HTTP service in http_api.c at /api/status/stream.
+ */
+extern struct http_resource_detail_dynamic sse_resource_detail;
+
+/**
+ * @brief Initialize the SSE status stream
+ *
+ * Registers the GPIO state-change callback that wakes a held stream.
+ * Must be called after gpio_control_init().
+ *
+ * @return 0 on success, negative errno on failure
+ */
+int http_sse_init(void);
+
+#endif /* HTTP_SSE_H */
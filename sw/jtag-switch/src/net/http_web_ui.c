@@ -2,7 +2,12 @@
  * Copyright (c) 2025 JTAG Switch Project
  * SPDX-License-Identifier: Apache-2.0
  *
- * HTTP Web UI Resources Implementation - STATIC Pattern
+ * HTTP Web UI Resources Implementation
+ *
+ * Serves the embedded, gzipped web resources with strong ETag validators
+ * generated from the source content at configure time. A reload with a
+ * matching If-None-Match costs a header exchange (304) instead of
+ * re-sending the bodies, keeping TX buffers free for the control path.
  */
 
 #include <zephyr/kernel.h>
@@ -10,12 +15,14 @@
 #include <zephyr/net/http/server.h>
 #include <zephyr/logging/log.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "http_web_ui.h"
+#include "web_resource_etags.h"
 
 LOG_MODULE_REGISTER(http_web_ui, LOG_LEVEL_INF);
 
-/* Embedded web resources (in FLASH/ROM) - UNCOMPRESSED */
+/* Embedded web resources (in FLASH/ROM) - gzip compressed */
 static const uint8_t index_html[] = {
 	#include "index.html.gz.inc"
 };
@@ -28,37 +35,111 @@ static const uint8_t app_js[] = {
 	#include "app.js.gz.inc"
 };
 
-/* STATIC resource definitions - following Zephyr sample pattern */
+#ifdef CONFIG_HTTP_SERVER_CAPTURE_HEADERS
+/* Ask the server to capture the conditional-GET validator */
+HTTP_SERVER_REGISTER_HEADER_CAPTURE(if_none_match, "If-None-Match");
+#endif
+
+/* One embedded resource plus the headers sent with its responses */
+struct web_resource {
+	const uint8_t *data;
+	size_t len;
+	const char *etag;
+	struct http_header headers[2];  /* ETag + Content-Encoding */
+};
+
+#define WEB_RESOURCE_DEFINE(_name, _data, _etag)			\
+	static struct web_resource _name = {				\
+		.data = _data,						\
+		.len = sizeof(_data),					\
+		.etag = _etag,						\
+		.headers = {						\
+			{ .name = "ETag", .value = _etag },		\
+			{ .name = "Content-Encoding", .value = "gzip" }, \
+		},							\
+	}
+
+WEB_RESOURCE_DEFINE(index_html_resource, index_html, WEB_ETAG_INDEX_HTML);
+WEB_RESOURCE_DEFINE(style_css_resource, style_css, WEB_ETAG_STYLE_CSS);
+WEB_RESOURCE_DEFINE(app_js_resource, app_js, WEB_ETAG_APP_JS);
+
+/**
+ * @brief Check whether the request carried a matching If-None-Match
+ */
+static bool etag_matches(struct http_client_ctx *client, const char *etag)
+{
+#ifdef CONFIG_HTTP_SERVER_CAPTURE_HEADERS
+	const struct http_header_capture_ctx *capture =
+		&client->header_capture_ctx;
+
+	for (size_t i = 0; i < capture->count; i++) {
+		if (strcasecmp(capture->headers[i].name, "If-None-Match") == 0) {
+			return strcmp(capture->headers[i].value, etag) == 0;
+		}
+	}
+#else
+	ARG_UNUSED(client);
+	ARG_UNUSED(etag);
+#endif
+	return false;
+}
+
+/* Shared handler for all embedded resources; user_data selects the blob */
+static int web_resource_handler(struct http_client_ctx *client,
+				enum http_data_status status,
+				const struct http_request_ctx *request_ctx,
+				struct http_response_ctx *response_ctx,
+				void *user_data)
+{
+	struct web_resource *res = user_data;
+
+	if (status != HTTP_SERVER_DATA_FINAL) {
+		return 0;
+	}
+
+	response_ctx->headers = res->headers;
+	response_ctx->header_count = ARRAY_SIZE(res->headers);
+	response_ctx->final_chunk = true;
+
+	if (etag_matches(client, res->etag)) {
+		/* Validator matches: the cached copy is current */
+		response_ctx->status = HTTP_304_NOT_MODIFIED;
+		return 0;
+	}
+
+	response_ctx->status = HTTP_200_OK;
+	response_ctx->body = res->data;
+	response_ctx->body_len = res->len;
+
+	return 0;
+}
 
-struct http_resource_detail_static index_resource_detail = {
+struct http_resource_detail_dynamic index_resource_detail = {
 	.common = {
-		.type = HTTP_RESOURCE_TYPE_STATIC,
+		.type = HTTP_RESOURCE_TYPE_DYNAMIC,
 		.bitmask_of_supported_http_methods = BIT(HTTP_GET),
 		.content_type = "text/html",
-		.content_encoding = "gzip"
 	},
-	.static_data = index_html,
-	.static_data_len = sizeof(index_html),
+	.cb = web_resource_handler,
+	.user_data = &index_html_resource,
 };
 
-struct http_resource_detail_static style_resource_detail = {
+struct http_resource_detail_dynamic style_resource_detail = {
 	.common = {
-		.type = HTTP_RESOURCE_TYPE_STATIC,
+		.type = HTTP_RESOURCE_TYPE_DYNAMIC,
 		.bitmask_of_supported_http_methods = BIT(HTTP_GET),
 		.content_type = "text/css",
-		.content_encoding = "gzip"
 	},
-	.static_data = style_css,
-	.static_data_len = sizeof(style_css),
+	.cb = web_resource_handler,
+	.user_data = &style_css_resource,
 };
 
-struct http_resource_detail_static app_js_resource_detail = {
+struct http_resource_detail_dynamic app_js_resource_detail = {
 	.common = {
-		.type = HTTP_RESOURCE_TYPE_STATIC,
+		.type = HTTP_RESOURCE_TYPE_DYNAMIC,
 		.bitmask_of_supported_http_methods = BIT(HTTP_GET),
 		.content_type = "text/javascript",
-		.content_encoding = "gzip"
 	},
-	.static_data = app_js,
-	.static_data_len = sizeof(app_js),
+	.cb = web_resource_handler,
+	.user_data = &app_js_resource,
 };
@@ -11,13 +11,14 @@
 #include <zephyr/net/http/service.h>
 
 /**
- * @brief Web UI STATIC resource details
+ * @brief Web UI resource details
  *
- * Serves web interface files (HTML, CSS, JS) as static resources.
- * Following Zephyr HTTP server best practices for static content.
+ * Serves the embedded web interface files (HTML, CSS, JS) with strong
+ * ETags generated at configure time; a request with a matching
+ * If-None-Match is answered with 304 Not Modified instead of the body.
  */
-extern struct http_resource_detail_static index_resource_detail;
-extern struct http_resource_detail_static style_resource_detail;
-extern struct http_resource_detail_static app_js_resource_detail;
+extern struct http_resource_detail_dynamic index_resource_detail;
+extern struct http_resource_detail_dynamic style_resource_detail;
+extern struct http_resource_detail_dynamic app_js_resource_detail;
 
 #endif /* HTTP_WEB_UI_H */
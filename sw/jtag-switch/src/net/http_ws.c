@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2025 JTAG Switch Project
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * WebSocket State-Push Module Implementation
+ *
+ * Holds up to MAX_WS_CLIENTS upgraded WebSocket connections and pushes a
+ * compact JSON state message only when select0/select1 or the link state
+ * actually change. Idle connections generate no traffic.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/http/server.h>
+#include <zephyr/net/http/service.h>
+#include <zephyr/net/websocket.h>
+#include <zephyr/net/net_mgmt.h>
+#include <zephyr/net/net_event.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/logging/log.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "http_ws.h"
+#include "../gpio/gpio_control.h"
+
+LOG_MODULE_REGISTER(http_ws, LOG_LEVEL_INF);
+
+#define MAX_WS_CLIENTS 4
+#define WS_RECV_BUFFER_SIZE 64
+#define WS_STATE_MSG_SIZE 96
+/* Bounded send: pushes run on the system workqueue with the slot mutex
+ * held, so a stalled peer (zero window, pulled cable) must not block
+ * either for the TCP retransmission give-up period
+ */
+#define WS_SEND_TIMEOUT_MS 100
+
+/* How often registered sockets are drained for inbound client frames */
+#define WS_RECV_POLL_MS 100
+
+/* Frames drained per socket per poll pass */
+#define WS_RECV_BUDGET 4
+
+/* Per-connection slot; sock < 0 means free */
+struct ws_client_slot {
+	int sock;
+	uint8_t recv_buf[WS_RECV_BUFFER_SIZE];
+};
+
+static struct ws_client_slot ws_clients[MAX_WS_CLIENTS] = {
+	[0 ... (MAX_WS_CLIENTS - 1)] = { .sock = -1 },
+};
+
+/* Protects the client slot table */
+static K_MUTEX_DEFINE(ws_clients_mutex);
+
+/* Last pushed state - used to suppress no-change notifications */
+static bool last_select0;
+static bool last_select1;
+static bool last_link_up;
+static bool last_state_valid;
+
+/* Network management event callback for link state changes */
+static struct net_mgmt_event_callback ws_net_mgmt_cb;
+
+/* Push work runs on the system work queue, never in the caller's context */
+static void ws_push_work_handler(struct k_work *work);
+static K_WORK_DEFINE(ws_push_work, ws_push_work_handler);
+
+/* Periodic receive poll: answers Ping, completes Close, reaps dead peers */
+static void ws_recv_work_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(ws_recv_work, ws_recv_work_handler);
+
+/**
+ * @brief Build the compact state message
+ * @return Message length, or negative errno on failure
+ */
+static int build_state_msg(char *buf, size_t buf_len,
+			   bool select0, bool select1, bool link_up)
+{
+	int len = snprintf(buf, buf_len,
+			   "{\"select0\":%s,\"select1\":%s,\"link\":%s}",
+			   select0 ? "true" : "false",
+			   select1 ? "true" : "false",
+			   link_up ? "true" : "false");
+
+	if (len < 0 || len >= (int)buf_len) {
+		return -ENOMEM;
+	}
+	return len;
+}
+
+/**
+ * @brief Send the state message to one client, releasing the slot on error
+ *
+ * A client that cannot take WS_SEND_TIMEOUT_MS worth of a ~50 byte
+ * message is stalled or gone; drop it rather than hold up the push.
+ */
+static void ws_send_to_slot(struct ws_client_slot *slot,
+			    const char *msg, size_t len)
+{
+	int ret = websocket_send_msg(slot->sock, (const uint8_t *)msg, len,
+				     WEBSOCKET_OPCODE_DATA_TEXT, true, true,
+				     WS_SEND_TIMEOUT_MS);
+	if (ret < 0) {
+		LOG_INF("WebSocket client disconnected (send: %d)", ret);
+		websocket_unregister(slot->sock);
+		slot->sock = -1;
+	}
+}
+
+static void ws_push_work_handler(struct k_work *work)
+{
+	char msg[WS_STATE_MSG_SIZE];
+	bool select0 = false, select1 = false;
+	bool link_up;
+	int len;
+
+	gpio_control_get_select(0, &select0);
+	gpio_control_get_select(1, &select1);
+	link_up = net_if_is_up(net_if_get_default());
+
+	k_mutex_lock(&ws_clients_mutex, K_FOREVER);
+
+	/* Only push when something actually changed since the last push */
+	if (last_state_valid &&
+	    select0 == last_select0 && select1 == last_select1 &&
+	    link_up == last_link_up) {
+		k_mutex_unlock(&ws_clients_mutex);
+		return;
+	}
+
+	last_select0 = select0;
+	last_select1 = select1;
+	last_link_up = link_up;
+	last_state_valid = true;
+
+	len = build_state_msg(msg, sizeof(msg), select0, select1, link_up);
+	if (len < 0) {
+		k_mutex_unlock(&ws_clients_mutex);
+		LOG_ERR("Failed to build state message: %d", len);
+		return;
+	}
+
+	for (int i = 0; i < MAX_WS_CLIENTS; i++) {
+		if (ws_clients[i].sock >= 0) {
+			ws_send_to_slot(&ws_clients[i], msg, len);
+		}
+	}
+
+	k_mutex_unlock(&ws_clients_mutex);
+}
+
+/**
+ * @brief Drain inbound frames from one client, non-blocking
+ *
+ * The stream is push-only, so data frames are discarded. Ping frames
+ * are answered with Pong and a Close frame is echoed to complete the
+ * closing handshake (RFC 6455 5.5.1); the slot is released on Close or
+ * any receive error. Called with ws_clients_mutex held.
+ */
+static void ws_drain_slot(struct ws_client_slot *slot)
+{
+	for (int i = 0; i < WS_RECV_BUDGET && slot->sock >= 0; i++) {
+		uint32_t msg_type = 0;
+		uint64_t remaining = 0;
+		int ret = websocket_recv_msg(slot->sock, slot->recv_buf,
+					     sizeof(slot->recv_buf),
+					     &msg_type, &remaining, 0);
+
+		if (ret == -EAGAIN || ret == -ETIMEDOUT) {
+			return;
+		}
+
+		if (ret < 0) {
+			LOG_INF("WebSocket client disconnected (recv: %d)", ret);
+			websocket_unregister(slot->sock);
+			slot->sock = -1;
+			return;
+		}
+
+		if (msg_type & WEBSOCKET_FLAG_CLOSE) {
+			websocket_send_msg(slot->sock, slot->recv_buf, ret,
+					   WEBSOCKET_OPCODE_CLOSE, true, true,
+					   WS_SEND_TIMEOUT_MS);
+			LOG_INF("WebSocket client closed connection");
+			websocket_unregister(slot->sock);
+			slot->sock = -1;
+			return;
+		}
+
+		if (msg_type & WEBSOCKET_FLAG_PING) {
+			websocket_send_msg(slot->sock, slot->recv_buf, ret,
+					   WEBSOCKET_OPCODE_PONG, true, true,
+					   WS_SEND_TIMEOUT_MS);
+		}
+	}
+}
+
+static void ws_recv_work_handler(struct k_work *work)
+{
+	k_mutex_lock(&ws_clients_mutex, K_FOREVER);
+
+	for (int i = 0; i < MAX_WS_CLIENTS; i++) {
+		if (ws_clients[i].sock >= 0) {
+			ws_drain_slot(&ws_clients[i]);
+		}
+	}
+
+	k_mutex_unlock(&ws_clients_mutex);
+
+	k_work_schedule(k_work_delayable_from_work(work),
+			K_MSEC(WS_RECV_POLL_MS));
+}
+
+/**
+ * @brief GPIO state-change callback - defers the push to the work queue
+ */
+static void ws_gpio_change_cb(void)
+{
+	k_work_submit(&ws_push_work);
+}
+
+/**
+ * @brief Network management event handler for link state changes
+ */
+static void ws_net_mgmt_event_handler(struct net_mgmt_event_callback *cb,
+				      uint64_t mgmt_event, struct net_if *iface)
+{
+	if (mgmt_event == NET_EVENT_IF_UP || mgmt_event == NET_EVENT_IF_DOWN) {
+		k_work_submit(&ws_push_work);
+	}
+}
+
+/**
+ * @brief WebSocket upgrade handler - claims a client slot
+ *
+ * Called by the HTTP server when a client upgrades /api/ws to WebSocket.
+ * The raw socket is wrapped with websocket_register() so state messages
+ * can be framed with websocket_send_msg().
+ */
+static int ws_setup_handler(int ws_socket, struct http_request_ctx *request_ctx,
+			    void *user_data)
+{
+	struct ws_client_slot *slot = NULL;
+	char msg[WS_STATE_MSG_SIZE];
+	bool select0 = false, select1 = false;
+	int sock, len;
+
+	k_mutex_lock(&ws_clients_mutex, K_FOREVER);
+
+	for (int i = 0; i < MAX_WS_CLIENTS; i++) {
+		if (ws_clients[i].sock < 0) {
+			slot = &ws_clients[i];
+			break;
+		}
+	}
+
+	if (slot == NULL) {
+		k_mutex_unlock(&ws_clients_mutex);
+		LOG_WRN("No free WebSocket client slots");
+		return -ENOMEM;
+	}
+
+	sock = websocket_register(ws_socket, slot->recv_buf,
+				  sizeof(slot->recv_buf));
+	if (sock < 0) {
+		k_mutex_unlock(&ws_clients_mutex);
+		LOG_ERR("Failed to register WebSocket: %d", sock);
+		return sock;
+	}
+
+	slot->sock = sock;
+	LOG_INF("WebSocket client connected");
+
+	/* Send current state immediately so the client needs no initial GET */
+	gpio_control_get_select(0, &select0);
+	gpio_control_get_select(1, &select1);
+	len = build_state_msg(msg, sizeof(msg), select0, select1,
+			      net_if_is_up(net_if_get_default()));
+	if (len > 0) {
+		ws_send_to_slot(slot, msg, len);
+	}
+
+	k_mutex_unlock(&ws_clients_mutex);
+
+	return 0;
+}
+
+struct http_resource_detail_websocket ws_resource_detail = {
+	.common = {
+		.type = HTTP_RESOURCE_TYPE_WEBSOCKET,
+		.bitmask_of_supported_http_methods = BIT(HTTP_GET),
+	},
+	.cb = ws_setup_handler,
+	.user_data = NULL,
+};
+
+int http_ws_init(void)
+{
+	int ret;
+
+	ret = gpio_control_register_change_cb(ws_gpio_change_cb);
+	if (ret < 0) {
+		LOG_ERR("Failed to register GPIO change callback: %d", ret);
+		return ret;
+	}
+
+	net_mgmt_init_event_callback(&ws_net_mgmt_cb, ws_net_mgmt_event_handler,
+				     NET_EVENT_IF_UP | NET_EVENT_IF_DOWN);
+	net_mgmt_add_event_callback(&ws_net_mgmt_cb);
+
+	k_work_schedule(&ws_recv_work, K_MSEC(WS_RECV_POLL_MS));
+
+	LOG_INF("WebSocket state-push initialized (max %d clients)",
+		MAX_WS_CLIENTS);
+
+	return 0;
+}
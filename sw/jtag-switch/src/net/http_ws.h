@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2025 JTAG Switch Project
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * WebSocket State-Push Module
+ *
+ * Pushes a compact state message to connected WebSocket clients whenever
+ * the select lines or the network link state change, so controllers do
+ * not have to poll GET /api/status.
+ */
+
+#ifndef HTTP_WS_H
+#define HTTP_WS_H
+
+#include <zephyr/net/http/service.h>
+
+/**
+ * @brief WebSocket endpoint resource detail
+ *
+ * Registered with the HTTP service in http_api.c at /api/ws.
+ */
+extern struct http_resource_detail_websocket ws_resource_detail;
+
+/**
+ * @brief Initialize WebSocket state-push module
+ *
+ * Registers the GPIO state-change callback and the network management
+ * event callback that trigger state pushes. Must be called after
+ * gpio_control_init().
+ *
+ * @return 0 on success, negative errno on failure
+ */
+int http_ws_init(void);
+
+#endif /* HTTP_WS_H */
@@ -18,6 +18,7 @@
 #include <stdlib.h>
 
 #include "network_config.h"
+#include "http_rest_api.h"
 
 LOG_MODULE_REGISTER(network_config, LOG_LEVEL_INF);
 
@@ -39,6 +40,10 @@ static struct network_config current_config = {
 static struct net_if *iface = NULL;
 static bool network_initialized = false;
 
+/* Provisional address installed while DHCP resolves, removed on bind */
+static struct in_addr provisional_addr;
+static bool provisional_addr_active;
+
 /* Network management event handler */
 static struct net_mgmt_event_callback net_mgmt_cb;
 
@@ -52,11 +57,20 @@ static void net_mgmt_event_handler(struct net_mgmt_event_callback *cb,
 		LOG_INF("IPv4 address added");
 	} else if (mgmt_event == NET_EVENT_IPV4_DHCP_BOUND) {
 		LOG_INF("DHCP bound");
+		if (provisional_addr_active) {
+			/* The leased address replaces the provisional one */
+			net_if_ipv4_addr_rm(iface, &provisional_addr);
+			provisional_addr_active = false;
+			LOG_INF("Provisional address released");
+		}
 	} else if (mgmt_event == NET_EVENT_IF_UP) {
 		LOG_INF("Network interface up");
 	} else if (mgmt_event == NET_EVENT_IF_DOWN) {
 		LOG_INF("Network interface down");
 	}
+
+	/* Network state feeds the /api/status response - drop the cache */
+	http_rest_api_status_invalidate();
 }
 
 /**
@@ -154,6 +168,20 @@ static int start_dhcp(struct net_if *iface)
 #endif
 }
 
+/**
+ * @brief Deferred DHCP start
+ *
+ * Runs on the system workqueue so boot never waits on the DHCP client;
+ * main() continues to http_server_start() immediately.
+ */
+static void dhcp_start_work_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+	(void)start_dhcp(iface);
+}
+
+static K_WORK_DEFINE(dhcp_start_work, dhcp_start_work_handler);
+
 /**
  * @brief Stop DHCP client
  */
@@ -295,6 +323,61 @@ int network_config_save(void)
 	return ret;
 }
 
+/* ========== USB Network Interface ========== */
+
+#if defined(CONFIG_USBD_CDC_NCM_CLASS) && DT_NODE_EXISTS(DT_NODELABEL(cdc_ncm0))
+
+/*
+ * Fixed point-to-point addressing on the USB link, USB gadget
+ * convention: the device is .1, the host configures .2. No DHCP, no
+ * discovery - a bench script reaches the control plane at a constant
+ * address the moment the cable is in.
+ */
+#define USB_NET_IP      "192.168.7.1"
+#define USB_NET_NETMASK "255.255.255.0"
+
+/**
+ * @brief Bring up the CDC-NCM interface with its fixed address
+ *
+ * The HTTP services and the UDP listener bind to every interface, so
+ * the whole control plane is reachable over the USB link with no
+ * further wiring. Failure is non-fatal: rack Ethernet is unaffected.
+ */
+static void usb_net_init(void)
+{
+	const struct device *dev = DEVICE_DT_GET(DT_NODELABEL(cdc_ncm0));
+	struct net_if *usb_iface;
+	struct in_addr addr;
+	struct in_addr mask;
+
+	usb_iface = net_if_lookup_by_dev(dev);
+	if (usb_iface == NULL) {
+		LOG_WRN("USB network interface not found");
+		return;
+	}
+
+	net_addr_pton(AF_INET, USB_NET_IP, &addr);
+	net_addr_pton(AF_INET, USB_NET_NETMASK, &mask);
+
+	if (net_if_ipv4_addr_add(usb_iface, &addr, NET_ADDR_MANUAL, 0) == NULL) {
+		LOG_ERR("Failed to address USB network interface");
+		return;
+	}
+	net_if_ipv4_set_netmask_by_addr(usb_iface, &addr, &mask);
+
+	net_if_up(usb_iface);
+
+	LOG_INF("USB network ready at %s (host side .2)", USB_NET_IP);
+}
+
+#else
+
+static inline void usb_net_init(void)
+{
+}
+
+#endif /* CONFIG_USBD_CDC_NCM_CLASS && cdc_ncm0 */
+
 int network_init(void)
 {
 	int ret;
@@ -342,12 +425,37 @@ int network_init(void)
 #endif
 
 	if (use_dhcp) {
+		const char *ip = current_config.static_ip;
+		const char *netmask = current_config.static_netmask;
+		const char *gateway = current_config.static_gateway;
+
 		current_config.dhcp_enabled = true;
-		ret = start_dhcp(iface);
-		if (ret < 0) {
-			LOG_ERR("Failed to start DHCP: %d", ret);
-			return ret;
+
+		/*
+		 * Install the last-known static address (or the Kconfig
+		 * default) provisionally so the HTTP API is reachable
+		 * within seconds of power-on; the address is removed when
+		 * the DHCP lease arrives.
+		 */
+		if (strlen(ip) == 0) {
+#ifdef CONFIG_NET_CONFIG_MY_IPV4_ADDR
+			ip = CONFIG_NET_CONFIG_MY_IPV4_ADDR;
+			netmask = CONFIG_NET_CONFIG_MY_IPV4_NETMASK;
+			gateway = CONFIG_NET_CONFIG_MY_IPV4_GW;
+#else
+			ip = NULL;
+#endif
+		}
+
+		if (ip != NULL && configure_static_ip(iface, ip, netmask,
+						      gateway) == 0) {
+			net_addr_pton(AF_INET, ip, &provisional_addr);
+			provisional_addr_active = true;
+			LOG_INF("Provisional address %s active until DHCP binds", ip);
 		}
+
+		/* Resolve the lease off the boot path */
+		k_work_submit(&dhcp_start_work);
 	} else {
 		/* Use static IP from NVS or Kconfig */
 		const char *ip = current_config.static_ip;
@@ -382,6 +490,9 @@ int network_init(void)
 	/* Bring interface up */
 	net_if_up(iface);
 
+	/* Second net_if: the USB CDC-NCM link for bench hosts */
+	usb_net_init();
+
 	network_initialized = true;
 	LOG_INF("Network subsystem initialized successfully");
 
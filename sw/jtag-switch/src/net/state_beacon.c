@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2025 JTAG Switch Project
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Multicast State Beacon Implementation
+ *
+ * Beacons are built from the same state that gpio_control_get_select and
+ * the network interface expose, sent from the system work queue: a state
+ * change submits the work immediately, and a delayable work item provides
+ * the slow heartbeat.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/logging/log.h>
+#include <string.h>
+
+#include "state_beacon.h"
+#include "../gpio/gpio_control.h"
+
+LOG_MODULE_REGISTER(state_beacon, LOG_LEVEL_INF);
+
+#define BEACON_MAGIC "JSB1"
+#define BEACON_LEN 20
+
+static int beacon_sock = -1;
+static struct sockaddr_in beacon_dest;
+static uint32_t beacon_seq;
+
+static void beacon_work_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(beacon_work, beacon_work_handler);
+
+/**
+ * @brief Build and send one beacon datagram
+ */
+static void send_beacon(void)
+{
+	uint8_t datagram[BEACON_LEN];
+	const struct net_linkaddr *link_addr;
+	bool select0 = false, select1 = false;
+	uint32_t uptime_s, seq;
+
+	memcpy(&datagram[0], BEACON_MAGIC, 4);
+
+	link_addr = net_if_get_link_addr(net_if_get_default());
+	if (link_addr != NULL && link_addr->len == 6) {
+		memcpy(&datagram[4], link_addr->addr, 6);
+	} else {
+		memset(&datagram[4], 0, 6);
+	}
+
+	gpio_control_get_select(0, &select0);
+	gpio_control_get_select(1, &select1);
+	datagram[10] = select0 ? 1 : 0;
+	datagram[11] = select1 ? 1 : 0;
+
+	uptime_s = htonl((uint32_t)(k_uptime_get() / 1000));
+	memcpy(&datagram[12], &uptime_s, 4);
+
+	seq = htonl(beacon_seq++);
+	memcpy(&datagram[16], &seq, 4);
+
+	if (zsock_sendto(beacon_sock, datagram, sizeof(datagram), 0,
+			 (struct sockaddr *)&beacon_dest,
+			 sizeof(beacon_dest)) < 0) {
+		LOG_WRN("Beacon send failed: %d", errno);
+	}
+}
+
+static void beacon_work_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	send_beacon();
+
+	/* Re-arm the heartbeat; a state change just restarts the interval */
+	k_work_schedule(&beacon_work,
+			K_SECONDS(STATE_BEACON_HEARTBEAT_SECONDS));
+}
+
+/**
+ * @brief GPIO state-change callback - beacon immediately
+ */
+static void beacon_gpio_change_cb(void)
+{
+	k_work_reschedule(&beacon_work, K_NO_WAIT);
+}
+
+int state_beacon_init(void)
+{
+	int ret;
+
+	beacon_sock = zsock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if (beacon_sock < 0) {
+		LOG_ERR("Failed to create beacon socket: %d", errno);
+		return -errno;
+	}
+
+	beacon_dest.sin_family = AF_INET;
+	beacon_dest.sin_port = htons(STATE_BEACON_PORT);
+	ret = zsock_inet_pton(AF_INET, STATE_BEACON_GROUP,
+			      &beacon_dest.sin_addr);
+	if (ret != 1) {
+		LOG_ERR("Invalid beacon group address");
+		zsock_close(beacon_sock);
+		beacon_sock = -1;
+		return -EINVAL;
+	}
+
+	ret = gpio_control_register_change_cb(beacon_gpio_change_cb);
+	if (ret < 0) {
+		LOG_ERR("Failed to register beacon change callback: %d", ret);
+		zsock_close(beacon_sock);
+		beacon_sock = -1;
+		return ret;
+	}
+
+	k_work_schedule(&beacon_work, K_NO_WAIT);
+
+	LOG_INF("State beacon started: %s:%d, heartbeat %d s",
+		STATE_BEACON_GROUP, STATE_BEACON_PORT,
+		STATE_BEACON_HEARTBEAT_SECONDS);
+
+	return 0;
+}
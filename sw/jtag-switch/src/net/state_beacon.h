@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2025 JTAG Switch Project
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Multicast State Beacon
+ *
+ * Periodically announces unit identity and switch state in a small
+ * multicast datagram, plus an immediate announcement on every state
+ * change. A fleet controller can passively learn the state of every
+ * unit with zero per-unit request load; the HTTP status endpoints
+ * become a fallback rather than the hot path.
+ *
+ * Datagram layout (network byte order, 20 bytes):
+ *   [0..3]   magic "JSB1"
+ *   [4..9]   unit MAC address
+ *   [10]     select0 state
+ *   [11]     select1 state
+ *   [12..15] uptime in seconds
+ *   [16..19] sequence number (increments per datagram)
+ */
+
+#ifndef STATE_BEACON_H
+#define STATE_BEACON_H
+
+#include <zephyr/kernel.h>
+
+/* Multicast group and port for beacon datagrams */
+#define STATE_BEACON_GROUP "239.255.76.83"
+#define STATE_BEACON_PORT 4521
+
+/* Slow heartbeat interval between state changes */
+#define STATE_BEACON_HEARTBEAT_SECONDS 10
+
+/**
+ * @brief Start the multicast state beacon
+ *
+ * Opens the beacon socket, registers the state-change callback and
+ * schedules the heartbeat. Network must be initialized first.
+ *
+ * @return 0 on success, negative errno on failure
+ */
+int state_beacon_init(void);
+
+#endif /* STATE_BEACON_H */
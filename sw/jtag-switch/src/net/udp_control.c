@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2025 JTAG Switch Project
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * UDP Binary Control Protocol Implementation
+ *
+ * A dedicated listener thread receives fixed three-byte commands and
+ * hands them to the gpio_control actuation thread, replying with a
+ * status byte plus the current state pair once the switch has executed.
+ * No header parsing, no JSON, no TCP handshake: command-to-pin latency
+ * is dominated by the GPIO driver itself.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/logging/log.h>
+#include <string.h>
+
+#include "udp_control.h"
+#include "../gpio/gpio_control.h"
+
+LOG_MODULE_REGISTER(udp_control, LOG_LEVEL_INF);
+
+#define UDP_CONTROL_REQUEST_LEN 3
+#define UDP_CONTROL_REPLY_LEN 3
+
+/*
+ * Listener thread priority: above the network RX threads
+ * (CONFIG_NET_RX_DEFAULT_PRIORITY=5) so a queued command datagram is
+ * acted on as soon as it is delivered.
+ */
+#define UDP_CONTROL_THREAD_PRIORITY 4
+#define UDP_CONTROL_THREAD_STACK_SIZE 2048
+
+/*
+ * Upper bound on how long a reply may wait for the actuation thread;
+ * generous next to the microsecond-scale switch itself, but a hard stop
+ * so a wedged GPIO driver cannot hang the listener.
+ */
+#define UDP_CONTROL_ACTUATION_TIMEOUT K_MSEC(100)
+
+static K_THREAD_STACK_DEFINE(udp_control_stack, UDP_CONTROL_THREAD_STACK_SIZE);
+static struct k_thread udp_control_thread;
+
+static int udp_sock = -1;
+
+/**
+ * @brief Execute one command and fill the reply
+ */
+static void process_command(const uint8_t *req, size_t req_len, uint8_t *reply)
+{
+	int ret = 0;
+	bool select0 = false, select1 = false;
+
+	if (req_len < UDP_CONTROL_REQUEST_LEN) {
+		ret = -EINVAL;
+	} else {
+		switch (req[0]) {
+		case UDP_CONTROL_CMD_SET:
+			gpio_control_set_event_source(GPIO_CONTROL_SRC_UDP);
+			ret = gpio_control_submit_select(req[1], req[2] != 0,
+						UDP_CONTROL_ACTUATION_TIMEOUT);
+			break;
+		case UDP_CONTROL_CMD_TOGGLE:
+			gpio_control_set_event_source(GPIO_CONTROL_SRC_UDP);
+			ret = gpio_control_submit_toggle(req[1],
+						UDP_CONTROL_ACTUATION_TIMEOUT);
+			break;
+		case UDP_CONTROL_CMD_GET:
+			/* State pair is appended to every reply below */
+			break;
+		default:
+			ret = -EINVAL;
+			break;
+		}
+	}
+
+	gpio_control_get_select(0, &select0);
+	gpio_control_get_select(1, &select1);
+
+	reply[0] = (ret < 0) ? (uint8_t)(-ret) : 0;
+	reply[1] = select0 ? 1 : 0;
+	reply[2] = select1 ? 1 : 0;
+}
+
+static void udp_control_thread_fn(void *p1, void *p2, void *p3)
+{
+	uint8_t req[UDP_CONTROL_REQUEST_LEN];
+	uint8_t reply[UDP_CONTROL_REPLY_LEN];
+	struct sockaddr_in client_addr;
+	socklen_t client_addr_len;
+	ssize_t received;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (1) {
+		client_addr_len = sizeof(client_addr);
+		received = zsock_recvfrom(udp_sock, req, sizeof(req), 0,
+					  (struct sockaddr *)&client_addr,
+					  &client_addr_len);
+		if (received < 0) {
+			LOG_ERR("recvfrom failed: %d", errno);
+			k_sleep(K_MSEC(100));
+			continue;
+		}
+
+		process_command(req, (size_t)received, reply);
+
+		if (zsock_sendto(udp_sock, reply, sizeof(reply), 0,
+				 (struct sockaddr *)&client_addr,
+				 client_addr_len) < 0) {
+			LOG_WRN("sendto failed: %d", errno);
+		}
+	}
+}
+
+int udp_control_init(void)
+{
+	struct sockaddr_in bind_addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(UDP_CONTROL_PORT),
+		.sin_addr = { .s_addr = INADDR_ANY },
+	};
+	int ret;
+
+	udp_sock = zsock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if (udp_sock < 0) {
+		LOG_ERR("Failed to create UDP socket: %d", errno);
+		return -errno;
+	}
+
+	ret = zsock_bind(udp_sock, (struct sockaddr *)&bind_addr,
+			 sizeof(bind_addr));
+	if (ret < 0) {
+		LOG_ERR("Failed to bind UDP socket: %d", errno);
+		zsock_close(udp_sock);
+		udp_sock = -1;
+		return -errno;
+	}
+
+	k_thread_create(&udp_control_thread, udp_control_stack,
+			K_THREAD_STACK_SIZEOF(udp_control_stack),
+			udp_control_thread_fn, NULL, NULL, NULL,
+			UDP_CONTROL_THREAD_PRIORITY, 0, K_NO_WAIT);
+	k_thread_name_set(&udp_control_thread, "udp_control");
+
+	LOG_INF("UDP control listener started on port %d", UDP_CONTROL_PORT);
+
+	return 0;
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2025 JTAG Switch Project
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * UDP Binary Control Protocol
+ *
+ * Minimal fixed-format datagram protocol for latency-critical switching,
+ * bypassing TCP, HTTP parsing and JSON entirely. The HTTP API remains the
+ * interface for humans; this path is for tight automated test loops.
+ *
+ * Request (3 bytes):
+ *   [0] command: 0x01 = set, 0x02 = toggle, 0x03 = get state
+ *   [1] select line (0 or 1; ignored for get state)
+ *   [2] state (0 or 1; set only, ignored otherwise)
+ *
+ * Reply (3 bytes):
+ *   [0] status: 0 = success, otherwise negated errno
+ *   [1] current select0 state
+ *   [2] current select1 state
+ */
+
+#ifndef UDP_CONTROL_H
+#define UDP_CONTROL_H
+
+#include <zephyr/kernel.h>
+
+/* UDP listen port (mirrors the USB product ID) */
+#define UDP_CONTROL_PORT 4520
+
+/* Command opcodes */
+#define UDP_CONTROL_CMD_SET    0x01
+#define UDP_CONTROL_CMD_TOGGLE 0x02
+#define UDP_CONTROL_CMD_GET    0x03
+
+/**
+ * @brief Start the UDP control listener
+ *
+ * Opens the control socket and spawns the listener thread. Network must
+ * be initialized before calling this function.
+ *
+ * @return 0 on success, negative errno on failure
+ */
+int udp_control_init(void);
+
+#endif /* UDP_CONTROL_H */
@@ -5,7 +5,10 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/shell/shell.h>
+#include <zephyr/logging/log.h>
 #include <stdlib.h>
+#include <string.h>
+#include "../boot_timing.h"
 #include "../gpio/gpio_control.h"
 #include "shell_cmds.h"
 
@@ -31,6 +34,7 @@ static int cmd_jtag_select0(const struct shell *sh, size_t argc, char **argv)
 	}
 
 	state = (value == 1);
+	gpio_control_set_event_source(GPIO_CONTROL_SRC_SHELL);
 	ret = gpio_control_set_select(0, state);
 	if (ret < 0) {
 		shell_error(sh, "Failed to set select0: %d", ret);
@@ -59,6 +63,7 @@ static int cmd_jtag_select1(const struct shell *sh, size_t argc, char **argv)
 	}
 
 	state = (value == 1);
+	gpio_control_set_event_source(GPIO_CONTROL_SRC_SHELL);
 	ret = gpio_control_set_select(1, state);
 	if (ret < 0) {
 		shell_error(sh, "Failed to set select1: %d", ret);
@@ -75,6 +80,7 @@ static int cmd_jtag_toggle0(const struct shell *sh, size_t argc, char **argv)
 	int ret;
 	bool state;
 
+	gpio_control_set_event_source(GPIO_CONTROL_SRC_SHELL);
 	ret = gpio_control_toggle_select(0);
 	if (ret < 0) {
 		shell_error(sh, "Failed to toggle select0: %d", ret);
@@ -97,6 +103,7 @@ static int cmd_jtag_toggle1(const struct shell *sh, size_t argc, char **argv)
 	int ret;
 	bool state;
 
+	gpio_control_set_event_source(GPIO_CONTROL_SRC_SHELL);
 	ret = gpio_control_toggle_select(1);
 	if (ret < 0) {
 		shell_error(sh, "Failed to toggle select1: %d", ret);
@@ -140,6 +147,511 @@ static int cmd_jtag_status(const struct shell *sh, size_t argc, char **argv)
 	return 0;
 }
 
+/* Shell command: jtag state [off|0|1 [delay_ms]|cancel] */
+static int cmd_jtag_state(const struct shell *sh, size_t argc, char **argv)
+{
+	static const char *const state_names[] = {
+		[JTAG_STATE_OFF] = "off",
+		[JTAG_STATE_CONN0] = "connector 0",
+		[JTAG_STATE_CONN1] = "connector 1",
+	};
+	enum jtag_switch_state state;
+	int ret;
+
+	if (argc == 1) {
+		ret = gpio_control_get_state(&state);
+		if (ret < 0) {
+			shell_error(sh, "Failed to get switch state: %d", ret);
+			return ret;
+		}
+		shell_print(sh, "Switch state: %s", state_names[state]);
+		return 0;
+	}
+
+	if (strcmp(argv[1], "cancel") == 0) {
+		ret = gpio_control_schedule_cancel();
+		if (ret == -ENOENT) {
+			shell_print(sh, "No scheduled switch pending");
+		} else {
+			shell_print(sh, "Scheduled switch cancelled");
+		}
+		return 0;
+	}
+
+	if (strcmp(argv[1], "off") == 0) {
+		state = JTAG_STATE_OFF;
+	} else if (strcmp(argv[1], "0") == 0) {
+		state = JTAG_STATE_CONN0;
+	} else if (strcmp(argv[1], "1") == 0) {
+		state = JTAG_STATE_CONN1;
+	} else {
+		shell_error(sh, "Usage: jtag state [off|0|1 [delay_ms]|cancel]");
+		return -EINVAL;
+	}
+
+	if (argc >= 3) {
+		/* Deferred: arm a kernel-timed switch and return immediately */
+		const int64_t at_ms = k_uptime_get() + atoi(argv[2]);
+
+		ret = gpio_control_schedule_state(state, at_ms);
+		if (ret < 0) {
+			shell_error(sh, "Failed to schedule switch state: %d", ret);
+			return ret;
+		}
+
+		shell_print(sh, "Switch to %s scheduled at uptime %lld ms",
+			    state_names[state], at_ms);
+		return 0;
+	}
+
+	gpio_control_set_event_source(GPIO_CONTROL_SRC_SHELL);
+	ret = gpio_control_set_state(state);
+	if (ret < 0) {
+		shell_error(sh, "Failed to set switch state: %d", ret);
+		return ret;
+	}
+
+	shell_print(sh, "Switch state set to %s", state_names[state]);
+	return 0;
+}
+
+/* Shell command: jtag latency [reset] */
+static int cmd_jtag_latency(const struct shell *sh, size_t argc, char **argv)
+{
+	struct gpio_control_latency_stats stats;
+	int ret;
+
+	if (argc == 2 && strcmp(argv[1], "reset") == 0) {
+		gpio_control_reset_latency_stats();
+		shell_print(sh, "Latency statistics reset");
+		return 0;
+	}
+
+	ret = gpio_control_get_latency_stats(&stats);
+	if (ret < 0) {
+		shell_error(sh, "Failed to get latency stats: %d", ret);
+		return ret;
+	}
+
+	if (stats.count == 0) {
+		shell_print(sh, "No switch operations recorded yet");
+		return 0;
+	}
+
+	shell_print(sh, "Switch latency (%u samples):", stats.count);
+	shell_print(sh, "  min: %u cycles (%u us)",
+		    stats.min_cycles, k_cyc_to_us_floor32(stats.min_cycles));
+	shell_print(sh, "  p50: %u cycles (%u us)",
+		    stats.p50_cycles, k_cyc_to_us_floor32(stats.p50_cycles));
+	shell_print(sh, "  p99: %u cycles (%u us)",
+		    stats.p99_cycles, k_cyc_to_us_floor32(stats.p99_cycles));
+	shell_print(sh, "  max: %u cycles (%u us)",
+		    stats.max_cycles, k_cyc_to_us_floor32(stats.max_cycles));
+
+	return 0;
+}
+
+/* Shell command: jtag boottime */
+static int cmd_jtag_boottime(const struct shell *sh, size_t argc, char **argv)
+{
+	const struct boot_phase *phases;
+	const int64_t ready_ms = boot_timing_ready_ms();
+	const int num_phases = boot_timing_get_phases(&phases);
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	if (num_phases == 0) {
+		shell_print(sh, "No boot phases recorded");
+		return 0;
+	}
+
+	shell_print(sh, "Boot phases:");
+	for (int i = 0; i < num_phases; i++) {
+		shell_print(sh, "  %-8s start %6u ms, took %6u ms",
+			    phases[i].name, phases[i].start_ms,
+			    phases[i].duration_ms);
+	}
+
+	if (ready_ms > 0) {
+		shell_print(sh, "Ready after %lld ms", ready_ms);
+	} else {
+		shell_print(sh, "Boot still in progress");
+	}
+
+	return 0;
+}
+
+/* Shell command: jtag fast [on|off] */
+static int cmd_jtag_fast(const struct shell *sh, size_t argc, char **argv)
+{
+	if (argc == 1) {
+		shell_print(sh, "Fast-switch mode: %s",
+			    gpio_control_get_fast_mode() ? "on" : "off");
+		return 0;
+	}
+
+	if (strcmp(argv[1], "on") == 0) {
+		gpio_control_set_fast_mode(true);
+	} else if (strcmp(argv[1], "off") == 0) {
+		gpio_control_set_fast_mode(false);
+	} else {
+		shell_error(sh, "Usage: jtag fast [on|off]");
+		return -EINVAL;
+	}
+
+	shell_print(sh, "Fast-switch mode %s", argv[1]);
+	return 0;
+}
+
+/* Shell command: jtag verify [inline|deferred] */
+static int cmd_jtag_verify(const struct shell *sh, size_t argc, char **argv)
+{
+	if (argc == 1) {
+		shell_print(sh, "Verification mode: %s",
+			    gpio_control_get_deferred_verify() ? "deferred" :
+							  "inline");
+		shell_print(sh, "Audit mismatches:  %u",
+			    gpio_control_get_verify_mismatches());
+		return 0;
+	}
+
+	if (strcmp(argv[1], "deferred") == 0) {
+		gpio_control_set_deferred_verify(true);
+	} else if (strcmp(argv[1], "inline") == 0) {
+		gpio_control_set_deferred_verify(false);
+	} else {
+		shell_error(sh, "Usage: jtag verify [inline|deferred]");
+		return -EINVAL;
+	}
+
+	shell_print(sh, "Verification mode %s", argv[1]);
+	return 0;
+}
+
+/* Shell command: jtag log <none|err|wrn|inf|dbg> */
+static int cmd_jtag_log(const struct shell *sh, size_t argc, char **argv)
+{
+	static const char *const level_names[] = {
+		[LOG_LEVEL_NONE] = "none",
+		[LOG_LEVEL_ERR] = "err",
+		[LOG_LEVEL_WRN] = "wrn",
+		[LOG_LEVEL_INF] = "inf",
+		[LOG_LEVEL_DBG] = "dbg",
+	};
+	int level = -1;
+	int ret;
+
+	if (argc != 2) {
+		shell_error(sh, "Usage: jtag log <none|err|wrn|inf|dbg>");
+		return -EINVAL;
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(level_names); i++) {
+		if (strcmp(argv[1], level_names[i]) == 0) {
+			level = i;
+			break;
+		}
+	}
+
+	if (level < 0) {
+		shell_error(sh, "Unknown level '%s'", argv[1]);
+		return -EINVAL;
+	}
+
+	ret = gpio_control_set_log_level(level);
+	if (ret == -ENOTSUP) {
+		shell_error(sh, "Runtime log filtering not enabled");
+		return ret;
+	}
+	if (ret < 0) {
+		shell_error(sh, "Failed to set log level: %d", ret);
+		return ret;
+	}
+
+	shell_print(sh, "gpio_control log level set to %s", argv[1]);
+	return 0;
+}
+
+/* ========================================================================
+ * Batched Sequence Command
+ * ======================================================================== */
+
+/* One parsed step of a jtag seq list */
+struct seq_step {
+	enum {
+		SEQ_STEP_SET,
+		SEQ_STEP_TOGGLE,
+		SEQ_STEP_DELAY,
+	} op;
+	uint8_t select_line;
+	bool state;
+	uint32_t delay_ms;
+};
+
+#define SEQ_MAX_STEPS 16
+#define SEQ_MAX_DELAY_MS 10000
+
+/**
+ * @brief Parse one step token into a seq_step
+ *
+ * Grammar: "<line>:<0|1>" sets a line, "t<line>" toggles a line,
+ * "d<ms>" delays. Returns 0 on success, -EINVAL on a malformed token.
+ */
+static int seq_parse_step(const char *token, size_t len, struct seq_step *step)
+{
+	const int num_lines = gpio_control_num_select_lines();
+
+	if (len == 0) {
+		return -EINVAL;
+	}
+
+	if (token[0] == 'd') {
+		long ms = 0;
+
+		if (len < 2) {
+			return -EINVAL;
+		}
+		for (size_t i = 1; i < len; i++) {
+			if (token[i] < '0' || token[i] > '9') {
+				return -EINVAL;
+			}
+			ms = ms * 10 + (token[i] - '0');
+			if (ms > SEQ_MAX_DELAY_MS) {
+				return -EINVAL;
+			}
+		}
+		step->op = SEQ_STEP_DELAY;
+		step->delay_ms = (uint32_t)ms;
+		return 0;
+	}
+
+	if (token[0] == 't') {
+		if (len != 2 || token[1] < '0' ||
+		    token[1] >= '0' + num_lines) {
+			return -EINVAL;
+		}
+		step->op = SEQ_STEP_TOGGLE;
+		step->select_line = token[1] - '0';
+		return 0;
+	}
+
+	if (len == 3 && token[1] == ':' &&
+	    token[0] >= '0' && token[0] < '0' + num_lines &&
+	    (token[2] == '0' || token[2] == '1')) {
+		step->op = SEQ_STEP_SET;
+		step->select_line = token[0] - '0';
+		step->state = (token[2] == '1');
+		return 0;
+	}
+
+	return -EINVAL;
+}
+
+/* Shell command: jtag seq <steps>
+ * e.g. jtag seq 0:1,d10,1:0,t0
+ */
+static int cmd_jtag_seq(const struct shell *sh, size_t argc, char **argv)
+{
+	struct seq_step steps[SEQ_MAX_STEPS];
+	size_t num_steps = 0;
+	const char *cursor;
+	int ret;
+
+	if (argc != 2) {
+		shell_error(sh,
+			    "Usage: jtag seq <step,step,...> where step is "
+			    "<line>:<0|1> (set), t<line> (toggle) or d<ms> (delay)");
+		return -EINVAL;
+	}
+
+	/*
+	 * Parse the whole list before touching any line, so a typo in step
+	 * five cannot leave the sequence half-executed.
+	 */
+	cursor = argv[1];
+	while (*cursor != '\0') {
+		const char *end = strchr(cursor, ',');
+		const size_t len = (end != NULL) ? (size_t)(end - cursor)
+						 : strlen(cursor);
+
+		if (num_steps >= SEQ_MAX_STEPS) {
+			shell_error(sh, "Too many steps (max %d)",
+				    SEQ_MAX_STEPS);
+			return -EINVAL;
+		}
+
+		ret = seq_parse_step(cursor, len, &steps[num_steps]);
+		if (ret < 0) {
+			shell_error(sh, "Invalid step at position %u: %.*s",
+				    (unsigned int)(num_steps + 1),
+				    (int)len, cursor);
+			return ret;
+		}
+
+		num_steps++;
+		cursor = (end != NULL) ? end + 1 : cursor + len;
+	}
+
+	if (num_steps == 0) {
+		shell_error(sh, "Empty step list");
+		return -EINVAL;
+	}
+
+	/*
+	 * Execute with kernel-timed delays. The mutex is taken per
+	 * operation, not across the whole sequence, so a long delay step
+	 * does not block other control paths.
+	 */
+	gpio_control_set_event_source(GPIO_CONTROL_SRC_SHELL);
+	for (size_t i = 0; i < num_steps; i++) {
+		switch (steps[i].op) {
+		case SEQ_STEP_SET:
+			ret = gpio_control_set_select(steps[i].select_line,
+						      steps[i].state);
+			break;
+		case SEQ_STEP_TOGGLE:
+			ret = gpio_control_toggle_select(steps[i].select_line);
+			break;
+		case SEQ_STEP_DELAY:
+			k_sleep(K_MSEC(steps[i].delay_ms));
+			ret = 0;
+			break;
+		}
+
+		if (ret < 0) {
+			shell_error(sh, "Sequence failed at step %u: %d",
+				    (unsigned int)(i + 1), ret);
+			return ret;
+		}
+	}
+
+	shell_print(sh, "Sequence completed (%u steps)",
+		    (unsigned int)num_steps);
+	return 0;
+}
+
+/* ========================================================================
+ * On-Target Microbenchmark
+ * ======================================================================== */
+
+/* Bounded by sample storage; plenty for stable percentiles */
+#define BENCH_MAX_ITERATIONS 1000
+#define BENCH_DEFAULT_ITERATIONS 100
+
+static uint32_t bench_samples[BENCH_MAX_ITERATIONS];
+
+/* In-place insertion sort; sample counts are small enough that this beats
+ * pulling qsort() into the image
+ */
+static void bench_sort(uint32_t *samples, int count)
+{
+	for (int i = 1; i < count; i++) {
+		uint32_t key = samples[i];
+		int j = i - 1;
+
+		while (j >= 0 && samples[j] > key) {
+			samples[j + 1] = samples[j];
+			j--;
+		}
+		samples[j + 1] = key;
+	}
+}
+
+static void bench_report(const struct shell *sh, const char *name,
+			 uint32_t *samples, int count)
+{
+	uint64_t sum = 0;
+
+	bench_sort(samples, count);
+
+	for (int i = 0; i < count; i++) {
+		sum += samples[i];
+	}
+
+	const uint32_t avg = (uint32_t)(sum / count);
+	const uint32_t p99 = samples[(count * 99) / 100];
+
+	shell_print(sh, "%s (%d iterations):", name, count);
+	shell_print(sh, "  min: %u cycles (%u us)",
+		    samples[0], k_cyc_to_us_floor32(samples[0]));
+	shell_print(sh, "  avg: %u cycles (%u us)",
+		    avg, k_cyc_to_us_floor32(avg));
+	shell_print(sh, "  p99: %u cycles (%u us)",
+		    p99, k_cyc_to_us_floor32(p99));
+	shell_print(sh, "  max: %u cycles (%u us)",
+		    samples[count - 1],
+		    k_cyc_to_us_floor32(samples[count - 1]));
+}
+
+/* Shell command: jtag bench [iterations] */
+static int cmd_jtag_bench(const struct shell *sh, size_t argc, char **argv)
+{
+	int iterations = BENCH_DEFAULT_ITERATIONS;
+	enum jtag_switch_state saved_state;
+	int ret;
+
+	if (argc >= 2) {
+		iterations = atoi(argv[1]);
+		if (iterations < 2 || iterations > BENCH_MAX_ITERATIONS) {
+			shell_error(sh, "Iterations must be 2..%d",
+				    BENCH_MAX_ITERATIONS);
+			return -EINVAL;
+		}
+	}
+
+	ret = gpio_control_get_state(&saved_state);
+	if (ret < 0) {
+		shell_error(sh, "Failed to get switch state: %d", ret);
+		return ret;
+	}
+
+	gpio_control_set_event_source(GPIO_CONTROL_SRC_SHELL);
+
+	/* Variant 1: simple set path - toggle one line (off <-> connector 0),
+	 * which takes the same-port masked-write fast path
+	 */
+	for (int i = 0; i < iterations; i++) {
+		const uint32_t start = k_cycle_get_32();
+
+		ret = gpio_control_toggle_select(0);
+		bench_samples[i] = k_cycle_get_32() - start;
+
+		if (ret < 0) {
+			shell_error(sh, "Toggle failed at iteration %d: %d",
+				    i, ret);
+			goto restore;
+		}
+	}
+	bench_report(sh, "Simple set (toggle select0)", bench_samples,
+		     iterations);
+
+	/* Variant 2: mutual-exclusion path - alternate connector 0 and
+	 * connector 1, forcing the ordered clear-then-set sequence on every
+	 * operation
+	 */
+	for (int i = 0; i < iterations; i++) {
+		const enum jtag_switch_state target =
+			(i & 1) ? JTAG_STATE_CONN1 : JTAG_STATE_CONN0;
+		const uint32_t start = k_cycle_get_32();
+
+		ret = gpio_control_set_state(target);
+		bench_samples[i] = k_cycle_get_32() - start;
+
+		if (ret < 0) {
+			shell_error(sh, "Set state failed at iteration %d: %d",
+				    i, ret);
+			goto restore;
+		}
+	}
+	bench_report(sh, "Mutual exclusion (alternate conn0/conn1)",
+		     bench_samples, iterations);
+
+restore:
+	gpio_control_set_state(saved_state);
+	return ret;
+}
+
 /* Register shell commands */
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_jtag,
 	SHELL_CMD(select0, NULL, "Set select0 line (0|1)", cmd_jtag_select0),
@@ -147,6 +659,24 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_jtag,
 	SHELL_CMD(toggle0, NULL, "Toggle select0 line", cmd_jtag_toggle0),
 	SHELL_CMD(toggle1, NULL, "Toggle select1 line", cmd_jtag_toggle1),
 	SHELL_CMD(status, NULL, "Show JTAG switch status", cmd_jtag_status),
+	SHELL_CMD(state, NULL, "Get/set switch state (state [off|0|1 [delay_ms]|cancel])",
+		  cmd_jtag_state),
+	SHELL_CMD(latency, NULL, "Show switch latency histogram (latency [reset])",
+		  cmd_jtag_latency),
+	SHELL_CMD(boottime, NULL, "Show boot-phase timing table",
+		  cmd_jtag_boottime),
+	SHELL_CMD(bench, NULL, "Benchmark switch operations (bench [iterations])",
+		  cmd_jtag_bench),
+	SHELL_CMD(seq, NULL,
+		  "Run a step sequence, e.g. seq 0:1,d10,1:0,t0",
+		  cmd_jtag_seq),
+	SHELL_CMD(fast, NULL, "Get/set fast-switch mode (fast [on|off])",
+		  cmd_jtag_fast),
+	SHELL_CMD(verify, NULL,
+		  "Get/set verification mode (verify [inline|deferred])",
+		  cmd_jtag_verify),
+	SHELL_CMD(log, NULL, "Set gpio_control log level (log <none|err|wrn|inf|dbg>)",
+		  cmd_jtag_log),
 	SHELL_SUBCMD_SET_END
 );
 
@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+"""
+JTAG Switch REST API Load Test Suite
+
+Drives the running target with concurrent GET /api/status and
+POST /api/select traffic and checks per-request latency percentiles and
+error rates against regression thresholds. This gives a repeatable
+throughput baseline for HTTP server tuning (client limits, buffer
+sizes) instead of anecdotes.
+
+The worker count stays below CONFIG_HTTP_SERVER_MAX_CLIENTS (4) so the
+test measures the request path, not connection rejection.
+
+Usage:
+    python test_load.py
+    pytest test_load.py -v
+    pytest test_load.py -m slow -v
+"""
+
+import threading
+import time
+import unittest
+import sys
+
+import pytest
+import requests
+
+from test_config import Config, config
+
+
+# Load shape: stays within the device's 4-client limit
+CONCURRENT_STATUS_WORKERS = 2
+CONCURRENT_SELECT_WORKERS = 1
+LOAD_DURATION_S = 10
+
+# Regression thresholds. Generous versus a healthy device (p99 well
+# under 200 ms on idle Ethernet) so only real regressions trip them,
+# not network jitter.
+MAX_ERROR_RATE = 0.05
+MAX_P50_S = 0.5
+MAX_P99_S = 2.0
+MIN_REQUESTS_PER_WORKER = 10
+
+
+def percentile(sorted_samples, fraction):
+    """Nearest-rank percentile from an already-sorted sample list"""
+    index = min(int(len(sorted_samples) * fraction), len(sorted_samples) - 1)
+    return sorted_samples[index]
+
+
+class LoadWorker(threading.Thread):
+    """
+    One HTTP client issuing requests back-to-back until the deadline
+
+    Each worker keeps its own requests.Session (one TCP connection) and
+    records per-request latency and outcome. Any non-200 response or
+    transport error counts as a failure.
+    """
+
+    def __init__(self, name, request_fn, deadline):
+        super().__init__(name=name, daemon=True)
+        self.request_fn = request_fn
+        self.deadline = deadline
+        self.latencies = []
+        self.errors = 0
+
+    def run(self):
+        session = requests.Session()
+        try:
+            while time.monotonic() < self.deadline:
+                start = time.monotonic()
+                try:
+                    response = self.request_fn(session)
+                    ok = response.status_code == 200
+                except requests.RequestException:
+                    ok = False
+                elapsed = time.monotonic() - start
+
+                if ok:
+                    self.latencies.append(elapsed)
+                else:
+                    self.errors += 1
+        finally:
+            session.close()
+
+
+@pytest.mark.slow
+@pytest.mark.timeout(60)
+class RestLoadTests(unittest.TestCase):
+    """Concurrent load against /api/status and /api/select"""
+
+    @classmethod
+    def setUpClass(cls):
+        cls.base_url = config.base_url
+        cls.timeout = (config.connect_timeout, config.read_timeout)
+
+        # Fail fast if the device is unreachable
+        try:
+            response = requests.get(f"{cls.base_url}/api/health",
+                                    timeout=cls.timeout)
+        except requests.RequestException as e:
+            raise unittest.SkipTest(f"Device not reachable: {e}")
+        if response.status_code != 200:
+            raise unittest.SkipTest(
+                f"Device not healthy (status {response.status_code})")
+
+    def _get_status(self, session):
+        return session.get(f"{self.base_url}/api/status",
+                           timeout=self.timeout)
+
+    def _post_select(self, session):
+        # Always drive line 0; keeping line 1 disabled preserves the
+        # mutual-exclusion invariant regardless of interleaving
+        self._select_state = not getattr(self, '_select_state', False)
+        return session.post(f"{self.base_url}/api/select",
+                            json={'line': 0,
+                                  'connector': int(self._select_state)},
+                            timeout=self.timeout)
+
+    def _report(self, label, latencies, errors):
+        """Print the measured distribution so runs double as baselines"""
+        total = len(latencies) + errors
+        latencies = sorted(latencies)
+        print(f"\n{label}: {total} requests, {errors} errors")
+        if latencies:
+            print(f"  p50: {percentile(latencies, 0.50) * 1000:.1f} ms")
+            print(f"  p95: {percentile(latencies, 0.95) * 1000:.1f} ms")
+            print(f"  p99: {percentile(latencies, 0.99) * 1000:.1f} ms")
+            print(f"  max: {latencies[-1] * 1000:.1f} ms")
+
+    def test_concurrent_load_meets_thresholds(self):
+        """Mixed GET/POST load should stay under latency/error thresholds"""
+        deadline = time.monotonic() + LOAD_DURATION_S
+
+        workers = [LoadWorker(f"status-{i}", self._get_status, deadline)
+                   for i in range(CONCURRENT_STATUS_WORKERS)]
+        workers += [LoadWorker(f"select-{i}", self._post_select, deadline)
+                    for i in range(CONCURRENT_SELECT_WORKERS)]
+
+        for worker in workers:
+            worker.start()
+        for worker in workers:
+            worker.join(timeout=LOAD_DURATION_S + config.read_timeout + 5)
+            self.assertFalse(worker.is_alive(),
+                             f"{worker.name} did not finish")
+
+        latencies = []
+        errors = 0
+        for worker in workers:
+            latencies.extend(worker.latencies)
+            errors += worker.errors
+            self.assertGreaterEqual(
+                len(worker.latencies) + worker.errors,
+                MIN_REQUESTS_PER_WORKER,
+                f"{worker.name} made too few requests to be meaningful")
+
+        self._report("Concurrent load", latencies, errors)
+
+        total = len(latencies) + errors
+        error_rate = errors / total
+        self.assertLessEqual(
+            error_rate, MAX_ERROR_RATE,
+            f"Error rate {error_rate:.1%} exceeds {MAX_ERROR_RATE:.0%}")
+
+        latencies.sort()
+        p50 = percentile(latencies, 0.50)
+        p99 = percentile(latencies, 0.99)
+        self.assertLessEqual(
+            p50, MAX_P50_S,
+            f"p50 latency {p50 * 1000:.0f} ms exceeds {MAX_P50_S * 1000:.0f} ms")
+        self.assertLessEqual(
+            p99, MAX_P99_S,
+            f"p99 latency {p99 * 1000:.0f} ms exceeds {MAX_P99_S * 1000:.0f} ms")
+
+    def test_select_states_consistent_after_load(self):
+        """Device should report a sane state once the load stops"""
+        response = requests.get(f"{self.base_url}/api/status",
+                                timeout=self.timeout)
+        self.assertEqual(response.status_code, 200)
+        data = response.json()
+        self.assertIn(data['select0'], [True, False])
+        self.assertIn(data['select1'], [True, False])
+        self.assertFalse(data['select0'] and data['select1'],
+                         "Both select lines active - invariant violated")
+
+
+def run_tests():
+    """Run the load tests standalone"""
+    global config
+    config = Config.from_args()
+
+    loader = unittest.TestLoader()
+    suite = unittest.TestSuite()
+    suite.addTests(loader.loadTestsFromTestCase(RestLoadTests))
+
+    runner = unittest.TextTestRunner(verbosity=2 if config.verbose else 1)
+    result = runner.run(suite)
+    return 0 if result.wasSuccessful() else 1
+
+
+if __name__ == '__main__':
+    sys.exit(run_tests())
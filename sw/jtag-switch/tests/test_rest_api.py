@@ -115,6 +115,36 @@ class StatusTests(BaseTestCase):
         if system['heap_used'] > 0:
             print(f"  Heap usage: {system['heap_used']} bytes")
 
+    def test_status_memory_telemetry(self):
+        """System section should report stack, net_buf and heap peaks"""
+        response = self.device.get('/status')
+        data = self.assert_json_response(response)
+
+        system = data['system']
+        self.assertIn('heap_max', system)
+        self.assertGreaterEqual(system['heap_max'], system['heap_used'],
+                                "Heap peak cannot be below current usage")
+
+        bufs = system['net_bufs']
+        # The connection serving this request holds at least one RX packet
+        self.assertGreater(bufs['rx_pkt_peak'], 0)
+        self.assertLessEqual(bufs['rx_pkt_peak'], bufs['rx_pkt_total'])
+        self.assertLessEqual(bufs['rx_data_used'], bufs['rx_data_total'])
+        self.assertLessEqual(bufs['tx_data_used'], bufs['tx_data_total'])
+
+        stacks = system['stacks']
+        self.assertGreater(len(stacks), 0, "No thread stack watermarks reported")
+        for entry in stacks:
+            self.assertGreater(entry['size'], 0)
+            self.assertLessEqual(
+                entry['peak'], entry['size'],
+                f"Thread {entry['name']} peak exceeds its stack size")
+
+        # Print the report: this is the data used to trim pool sizes
+        for entry in sorted(stacks, key=lambda e: e['size'] - e['peak']):
+            print(f"  stack {entry['name']:<16} peak {entry['peak']:>5}"
+                  f" / {entry['size']:>5}")
+
     def test_status_gpio_states(self):
         """Status response should have boolean GPIO states"""
         response = self.device.get('/status')
@@ -152,6 +182,30 @@ class InfoTests(BaseTestCase):
         self.assertIsInstance(data['zephyr'], str)
         self.assertIsInstance(data['board'], str)
 
+    def test_info_boot_timing(self):
+        """Info should carry the boot-phase timing table"""
+        response = self.device.get('/info')
+        data = self.assert_json_response(response, required_fields=['boot'])
+
+        boot = data['boot']
+        # Any device answering this request finished booting long ago
+        self.assertGreater(boot['ready_ms'], 0)
+
+        phases = boot['phases']
+        self.assertGreater(len(phases), 0, "No boot phases recorded")
+        phase_names = [p['name'] for p in phases]
+        self.assertIn('gpio', phase_names)
+        self.assertIn('http', phase_names)
+
+        for phase in phases:
+            self.assertGreaterEqual(phase['ms'], 0)
+            self.assertLessEqual(phase['start_ms'] + phase['ms'],
+                                 boot['ready_ms'],
+                                 f"Phase {phase['name']} ends after ready")
+
+        for phase in sorted(phases, key=lambda p: -p['ms']):
+            print(f"  boot phase {phase['name']:<8} {phase['ms']:>6} ms")
+
     def test_info_device_name(self):
         """Info should report correct device name"""
         response = self.device.get('/info')
@@ -294,6 +348,57 @@ class SelectTests(BaseTestCase):
             self.fail("GPIO mutual exclusion violated: both lines are HIGH")
 
 
+@pytest.mark.timeout(30)
+class ScheduledSelectTests(BaseTestCase):
+    """Test deferred switching via the optional delay_ms/at_ms select fields"""
+
+    def test_immediate_select_not_scheduled(self):
+        """A request without a deadline reports scheduled=false"""
+        response = self.device.post('/select', {'line': 0, 'connector': 0})
+        data = self.assert_json_response(response,
+                                         required_fields=['success', 'scheduled'])
+        self.assertTrue(data['success'])
+        self.assertFalse(data['scheduled'])
+
+    def test_scheduled_select_fires_after_delay(self):
+        """A delay_ms request returns immediately and lands at the deadline"""
+        # Start from a known state
+        self.device.post('/select', {'line': 0, 'connector': 0})
+        time.sleep(0.1)
+
+        response = self.device.post('/select',
+                                    {'line': 0, 'connector': 1, 'delay_ms': 500})
+        data = self.assert_json_response(response,
+                                         required_fields=['success', 'scheduled'])
+        self.assertTrue(data['success'])
+        self.assertTrue(data['scheduled'])
+
+        # The change must not have landed yet
+        status = self.get_device_status()
+        self.assertFalse(status['select0'],
+                         "Change landed before the requested deadline")
+
+        # ... but must have landed once the deadline has passed
+        time.sleep(0.8)
+        status = self.get_device_status()
+        self.assertTrue(status['select0'],
+                        "Change did not land after the requested deadline")
+
+    def test_scheduled_select_replaced_by_newer_schedule(self):
+        """A new schedule replaces a pending one"""
+        self.device.post('/select', {'line': 0, 'connector': 0})
+        time.sleep(0.1)
+
+        self.device.post('/select', {'line': 0, 'connector': 1, 'delay_ms': 300})
+        self.device.post('/select', {'line': 1, 'connector': 1, 'delay_ms': 300})
+        time.sleep(0.6)
+
+        # Only the second schedule should have fired
+        status = self.get_device_status()
+        self.assertFalse(status['select0'], "Replaced schedule still fired")
+        self.assertTrue(status['select1'], "Replacing schedule did not fire")
+
+
 @pytest.mark.timeout(30)
 class ToggleTests(BaseTestCase):
     """Test POST /api/toggle endpoint"""
@@ -364,7 +469,191 @@ class ToggleTests(BaseTestCase):
         self.assert_error_response(response, expected_status=400)
 
 
+@pytest.mark.timeout(30)
+class BatchTests(BaseTestCase):
+    """Test POST /api/batch endpoint"""
+
+    def test_batch_single_set(self):
+        """Batch with a single set operation"""
+        response = self.device.post('/batch', {
+            'ops': [{'op': 'set', 'line': 0, 'state': 1}]
+        })
+        data = self.assert_json_response(response, required_fields=['success'])
+        self.assertTrue(data['success'])
+        self.assertTrue(data['select0'])
+
+    def test_batch_handover_sequence(self):
+        """Typical probe handover: clear one line, set the other"""
+        response = self.device.post('/batch', {
+            'ops': [
+                {'op': 'set', 'line': 1, 'state': 0},
+                {'op': 'set', 'line': 0, 'state': 1},
+            ]
+        })
+        data = self.assert_json_response(response, required_fields=['success'])
+        self.assertTrue(data['success'])
+        self.assertTrue(data['select0'])
+        self.assertFalse(data['select1'])
+
+    def test_batch_toggle_operation(self):
+        """Batch toggle should flip the line state"""
+        # Establish a known state first
+        self.device.post('/batch', {
+            'ops': [{'op': 'set', 'line': 0, 'state': 0}]
+        })
+        response = self.device.post('/batch', {
+            'ops': [{'op': 'toggle', 'line': 0}]
+        })
+        data = self.assert_json_response(response, required_fields=['success'])
+        self.assertTrue(data['success'])
+        self.assertTrue(data['select0'])
+
+    def test_batch_preserves_mutual_exclusion(self):
+        """Batch must never leave both lines HIGH"""
+        response = self.device.post('/batch', {
+            'ops': [
+                {'op': 'set', 'line': 0, 'state': 1},
+                {'op': 'set', 'line': 1, 'state': 1},
+            ]
+        })
+        data = self.assert_json_response(response, required_fields=['success'])
+        self.assertFalse(data['select0'] and data['select1'],
+                         "GPIO mutual exclusion violated by batch")
+
+    def test_batch_empty_ops_rejected(self):
+        """Empty operation list should return HTTP 400"""
+        response = self.device.post('/batch', {'ops': []})
+        self.assert_error_response(response, expected_status=400)
+
+    def test_batch_invalid_line_rejected(self):
+        """Invalid line number should return HTTP 400"""
+        response = self.device.post('/batch', {
+            'ops': [{'op': 'set', 'line': 2, 'state': 1}]
+        })
+        self.assert_error_response(response, expected_status=400)
+
+    def test_batch_invalid_op_rejected(self):
+        """Unknown operation name should return HTTP 400"""
+        response = self.device.post('/batch', {
+            'ops': [{'op': 'frobnicate', 'line': 0, 'state': 1}]
+        })
+        self.assert_error_response(response, expected_status=400)
+
+
+@pytest.mark.timeout(30)
+class MetricsTests(BaseTestCase):
+    """Test GET /api/metrics endpoint"""
+
+    def test_metrics_returns_200(self):
+        """Metrics endpoint should return HTTP 200"""
+        response = self.device.get('/metrics')
+        self.assertEqual(response.status_code, 200)
+
+    def test_metrics_is_text_exposition(self):
+        """Metrics should be Prometheus text format, not JSON"""
+        response = self.device.get('/metrics')
+        self.assertIn('text/plain', response.headers.get('Content-Type', ''))
+        self.assertIn('# TYPE jtag_http_requests_total counter', response.text)
+
+    def test_metrics_counts_requests(self):
+        """Request counters should increase between scrapes"""
+        self.device.get('/status')
+        first = self.device.get('/metrics').text
+        self.device.get('/status')
+        second = self.device.get('/metrics').text
+
+        def status_count(body):
+            for line in body.splitlines():
+                if line.startswith('jtag_http_requests_total{endpoint="status"}'):
+                    return int(line.rsplit(' ', 1)[1])
+            self.fail("status request counter missing from exposition")
+
+        self.assertGreater(status_count(second), status_count(first))
+
+    def test_metrics_has_switch_histogram(self):
+        """Metrics should include the switch latency histogram"""
+        # Perform a switch so at least one sample exists
+        self.device.post('/select', {'line': 0, 'connector': 0})
+        response = self.device.get('/metrics')
+        self.assertIn('jtag_switch_latency_cycles_bucket', response.text)
+        self.assertIn('jtag_switch_operations_total', response.text)
+
+
 @pytest.mark.network
+@pytest.mark.timeout(30)
+class StatusStreamTests(BaseTestCase):
+    """Test GET /api/status/stream SSE endpoint"""
+
+    def test_stream_sends_initial_state(self):
+        """A fresh connection delivers the current state as an SSE event"""
+        response = self.device.get('/status/stream', stream=True)
+        self.assertEqual(response.status_code, 200)
+        self.assertIn('text/event-stream', response.headers.get('Content-Type', ''))
+
+        body = b''
+        for chunk in response.iter_content(chunk_size=64):
+            body += chunk
+            if b'data: ' in body:
+                break
+        response.close()
+
+        self.assertIn(b'data: ', body)
+        self.assertIn(b'"select0"', body)
+        self.assertIn(b'"select1"', body)
+
+
+@pytest.mark.timeout(30)
+class EventsTests(BaseTestCase):
+    """Test GET /api/events endpoint"""
+
+    def test_events_records_state_changes(self):
+        """State changes show up as ordered, sourced events"""
+        # Force two real transitions
+        self.device.post('/select', {'line': 0, 'connector': 0})
+        self.device.post('/select', {'line': 0, 'connector': 1})
+        self.device.post('/select', {'line': 0, 'connector': 0})
+        time.sleep(0.1)
+
+        response = self.device.get('/events')
+        data = self.assert_json_response(response, required_fields=['next', 'events'])
+        self.assertGreaterEqual(len(data['events']), 2)
+
+        for event in data['events']:
+            self.assertIn('seq', event)
+            self.assertIn('t_ms', event)
+            self.assertIn('old', event)
+            self.assertIn('new', event)
+            self.assertIn('source', event)
+            self.assertNotEqual(event['old'], event['new'])
+
+        # REST-driven changes must be tagged as such
+        self.assertTrue(any(e['source'] == 'rest' for e in data['events']))
+
+        # Sequence numbers must be strictly increasing
+        seqs = [e['seq'] for e in data['events']]
+        self.assertEqual(seqs, sorted(seqs))
+
+    def test_events_since_cursor_drains(self):
+        """The since cursor returns only events newer than it"""
+        response = self.device.get('/events')
+        cursor = self.assert_json_response(response)['next']
+
+        # Nothing new yet
+        response = self.device.get('/events?since=%d' % cursor)
+        data = self.assert_json_response(response)
+        self.assertEqual(data['events'], [])
+
+        # One new transition produces exactly the newer events
+        self.device.post('/toggle', {'line': 0})
+        time.sleep(0.1)
+
+        response = self.device.get('/events?since=%d' % cursor)
+        data = self.assert_json_response(response)
+        self.assertGreaterEqual(len(data['events']), 1)
+        for event in data['events']:
+            self.assertGreater(event['seq'], cursor)
+
+
 @pytest.mark.timeout(30)
 class NetworkConfigTests(BaseTestCase):
     """Test POST /api/network/config endpoint"""
@@ -407,6 +696,46 @@ class NetworkConfigTests(BaseTestCase):
         self.assert_error_response(response, expected_status=400)
 
 
+@pytest.mark.timeout(30)
+class ControlPortTests(BaseTestCase):
+    """Test the dedicated automation API service on port 8080"""
+
+    CONTROL_PORT = 8080
+
+    def _control_url(self, endpoint):
+        return f"http://{config.device_ip}:{self.CONTROL_PORT}/api{endpoint}"
+
+    def test_control_port_health(self):
+        """Health endpoint should answer on the automation port"""
+        response = self.device.session.get(self._control_url('/health'),
+                                           timeout=self.device.timeout)
+        self.assertEqual(response.status_code, 200)
+        self.assertEqual(response.json()['status'], 'ok')
+
+    def test_control_port_select(self):
+        """Select posted on the automation port should actuate normally"""
+        response = self.device.session.post(
+            self._control_url('/select'),
+            json={'line': 0, 'connector': 0},
+            timeout=self.device.timeout)
+        self.assertEqual(response.status_code, 200)
+        data = response.json()
+        self.assertTrue(data['success'])
+        self.assertFalse(data['select0'])
+
+        # State is shared with the port-80 service
+        status = self.device.get('/status').json()
+        self.assertFalse(status['select0'])
+
+    def test_control_port_has_no_web_ui(self):
+        """The automation service must not carry the dashboard assets"""
+        response = self.device.session.get(
+            f"http://{config.device_ip}:{self.CONTROL_PORT}/",
+            timeout=self.device.timeout)
+        self.assertNotEqual(response.status_code, 200,
+                            "Web UI should only be served on port 80")
+
+
 def run_tests():
     """Run all tests and print summary"""
     # Update config from command line args
@@ -421,6 +421,49 @@ class PollingTests(WebUITestCase):
         self.assertTrue(self.page_helper.is_connected())
 
 
+# ============================================================================
+# Conditional GET Tests (2 tests) - plain HTTP, no browser needed
+# ============================================================================
+
+
+@pytest.mark.web_ui
+@pytest.mark.timeout(30)
+class ConditionalGetTests(unittest.TestCase):
+    """Test ETag/If-None-Match handling for the embedded web resources"""
+
+    device = None
+
+    @classmethod
+    def setUpClass(cls):
+        cls.device = DeviceConnection(config.base_url)
+
+    @classmethod
+    def tearDownClass(cls):
+        if cls.device:
+            cls.device.close()
+
+    def test_responses_carry_etag(self):
+        """Every web resource should be served with an ETag header"""
+        for path in ['/', '/style.css', '/app.js']:
+            response = self.device.get(path)
+            self.assertEqual(response.status_code, 200, f"{path} should load")
+            self.assertIn('ETag', response.headers,
+                          f"{path} response should carry an ETag")
+
+    def test_matching_validator_returns_304(self):
+        """A revalidation with the served ETag should get 304 with no body"""
+        response = self.device.get('/')
+        self.assertEqual(response.status_code, 200)
+        etag = response.headers.get('ETag')
+        self.assertIsNotNone(etag, "Index response should carry an ETag")
+
+        revalidation = self.device.get('/', headers={'If-None-Match': etag})
+        self.assertEqual(revalidation.status_code, 304,
+                         "Matching If-None-Match should be answered with 304")
+        self.assertEqual(len(revalidation.content), 0,
+                         "304 response should not carry a body")
+
+
 # ============================================================================
 # Test Runner
 # ============================================================================
@@ -439,6 +482,7 @@ def run_tests():
     suite.addTests(loader.loadTestsFromTestCase(PageLoadTests))
     suite.addTests(loader.loadTestsFromTestCase(JtagControlTests))
     suite.addTests(loader.loadTestsFromTestCase(PollingTests))
+    suite.addTests(loader.loadTestsFromTestCase(ConditionalGetTests))
 
     # Run tests
     runner = unittest.TextTestRunner(verbosity=2 if config.verbose else 1)
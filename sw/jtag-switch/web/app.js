@@ -1,9 +1,9 @@
-// Polling-based status updates (no WebSocket)
+// JTAG state arrives via SSE (/api/status/stream); system info is polled
 let systemInfoTimer = null;
-let jtagStateTimer = null;  // Separate timer for JTAG state polling
+let statusStream = null;  // EventSource for JTAG state updates
 const SYSTEM_INFO_POLL_INTERVAL_MS = 10000;  // Poll system info every 10s
-const JTAG_STATE_POLL_INTERVAL_MS = 2000;    // Poll JTAG state every 2s
 const FETCH_TIMEOUT_MS = 3000;               // Fetch timeout (3 seconds)
+const STREAM_RETRY_MS = 3000;                // Re-open a dead stream after 3s
 
 // ============================================================================
 // Fetch with Timeout - Detect disconnections quickly
@@ -153,18 +153,16 @@ async function pollSystemInfo() {
 }
 
 // ============================================================================
-// JTAG State Polling - Check for external changes (e.g., serial console)
+// JTAG State Stream - Pushed on change (e.g., serial console, other clients)
 // ============================================================================
-async function pollJTAGState() {
-    try {
-        const response = await fetchWithTimeout('/api/status');
-        if (!response.ok) {
-            throw new Error(`HTTP ${response.status}`);
-        }
+function startJTAGStateStream() {
+    stopJTAGStateStream();
 
-        const data = await response.json();
+    statusStream = new EventSource('/api/status/stream');
+
+    statusStream.onmessage = (e) => {
+        const data = JSON.parse(e.data);
 
-        // Only update JTAG states (not system/network info to avoid redundancy)
         if (data.select0 !== undefined) {
             updateJTAGState('line0-state', data.select0);
         }
@@ -172,22 +170,24 @@ async function pollJTAGState() {
             updateJTAGState('line1-state', data.select1);
         }
         setConnected(true);
+    };
 
-    } catch (error) {
-        console.error('Failed to poll JTAG state:', error);
-        setConnected(false);
-    }
-}
+    statusStream.onopen = () => setConnected(true);
 
-function startJTAGStatePolling() {
-    stopJTAGStatePolling();
-    jtagStateTimer = setInterval(pollJTAGState, JTAG_STATE_POLL_INTERVAL_MS);
+    statusStream.onerror = () => {
+        // The device ends each response after a short hold and EventSource
+        // reconnects on its own; only a closed stream means it gave up.
+        if (statusStream && statusStream.readyState === EventSource.CLOSED) {
+            setConnected(false);
+            setTimeout(startJTAGStateStream, STREAM_RETRY_MS);
+        }
+    };
 }
 
-function stopJTAGStatePolling() {
-    if (jtagStateTimer) {
-        clearInterval(jtagStateTimer);
-        jtagStateTimer = null;
+function stopJTAGStateStream() {
+    if (statusStream) {
+        statusStream.close();
+        statusStream = null;
     }
 }
 
@@ -339,12 +339,12 @@ window.addEventListener('load', async () => {
     // Start polling system info (10s interval)
     startSystemInfoPolling();
 
-    // Start polling JTAG state (2s interval)
-    startJTAGStatePolling();
+    // Open the JTAG state event stream (pushed on change)
+    startJTAGStateStream();
 });
 
-// Stop polling when page unloads (cleanup)
+// Stop polling and close the stream when page unloads (cleanup)
 window.addEventListener('beforeunload', () => {
     stopSystemInfoPolling();
-    stopJTAGStatePolling();
+    stopJTAGStateStream();
 });